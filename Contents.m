@@ -27,8 +27,14 @@
 %
 % Flow Algorithms
 % max_flow                  - Solve a maximum flow problem
+% dinic_max_flow            - Dinic's max flow algorithm
 % edmunds_karp_max_flow     - Edmunds-Karp max flow algorithm
+% global_min_cut            - Minimum cut over all the vertex partitions
+% gomory_hu_tree            - Gomory-Hu cut tree of all the minimum cuts
 % kolmogorov_max_flow       - Kolmogorov's max flow algorithm
+% multiway_cut              - Approximate multiway cut from isolating cuts
+% parametric_max_flow       - Max flows with monotone terminal capacities
+% pseudoflow_max_flow       - Hochbaum's pseudoflow max flow algorithm
 % push_relabel_max_flow     - Goldberg's push-relabel max flow algorithm
 %
 % Layouts
@@ -43,14 +49,24 @@
 % edmonds_maximum_cardinality_matching - Edmonds' algorithm for matching 
 % maximal_matching          - Compute maximal (not maximum) matchings
 % test_matching             - Test if a matching is maximum cardinality
+% weighted_matching         - Compute a 1/2-approximate maximum weight matching
 %
 % Statistics
 % betweenness_centrality    - Betweeness centrality scores for all nodes
+% closeness_centrality      - Closeness and harmonic centrality for all nodes
 % clustering_coefficients   - Clustering coefficients for all nodes
+% sampled_clustering_coefficients - Estimate clustering coefficients
 % core_numbers              - Compute in-degree core numbers for all nodes
+% update_core_numbers       - Update core numbers after edge changes
+% dominator_tree            - Compute dominator trees from a set of roots
 % lengauer_tarjan_dominator_tree - Compute a dominator tree for a graph
+% pagerank                  - PageRank and personalized PageRank vectors
+% local_pagerank            - Local personalized PageRank with push steps
+% local_flow_improve        - Improve the conductance of a set with max flows
 % num_edges                 - The number of edges in a graph
 % num_vertices              - The number of vertices in a graph
+% triangle_counts           - Count triangles at each edge
+% truss_numbers             - Compute k-truss numbers for all edges
 % topological_order         - Compute a topological order for a dag
 % test_dag                  - Test if a graph is directed and acyclic
 %
@@ -11,6 +11,8 @@ function [bc,E] = betweenness_centrality(A,varargin)
 % This method works on weighted or weighted directed graphs.
 % For unweighted graphs (options.unweighted=1), the runtime is O(VE).
 % For weighted graphs, the runtime is O(VE + V(V+E)log(V)).
+% When libmbgl is compiled with OpenMP, the sources are split among the
+% threads, and each thread uses O(V+E) extra memory.
 %
 % ... = betweenness_centrality(A,...) takes a set of
 % key-value pairs or an options structure.  See set_matlab_bgl_options
@@ -22,6 +24,20 @@ function [bc,E] = betweenness_centrality(A,varargin)
 %       weight for each node, see EDGE_INDEX and EXAMPLES/REWEIGHTED_GRAPHS
 %       for information on how to use this option correctly
 %       [{'matrix'} | length(nnz(A)) double vector]
+%   options.approx: estimate the centrality from a random sample of 
+%       sources instead of using every vertex as a source [{0} | 1]
+%   options.epsilon: the accuracy of the estimate, see below [{0.01}]
+%   options.delta: the probability that the estimate fails [{0.1}]
+%   options.samples: the largest number of sources to sample, 0 for no 
+%       limit [{0}]
+%   options.seed: the random seed [{0}]
+%
+% Note: with options.approx=1, the estimate of each vertex is within 
+% epsilon*n*(n-2) of the exact value with probability at least 1-delta.
+% The sampling stops early once an empirical Bernstein bound shows the 
+% estimate is accurate enough.  Use options.epsilon=0 to sample exactly
+% options.samples sources.  The estimate is scaled like the exact 
+% centrality, so the output does not change otherwise.
 %
 % Note: the edge centrality can also be returned as an edge list using the
 % options.ec_list options.  This option can eliminate some ambiguity in the
@@ -47,12 +63,15 @@ function [bc,E] = betweenness_centrality(A,varargin)
 %  2007-07-09: Restricted input to positive edge weights
 %  2007-07-12: Fixed edge_weight documentation.
 %  2008-10-07: Changed options parsing
+%  2026-10-19: Documented the parallel computation
+%    Added options for sampled approximate centrality
 %%
 
 [trans check full2sparse] = get_matlab_bgl_options(varargin{:});
 if full2sparse && ~issparse(A), A = sparse(A); end
 
-options = struct('unweighted', 0, 'ec_list', 0, 'edge_weight', 'matrix');
+options = struct('unweighted', 0, 'ec_list', 0, 'edge_weight', 'matrix', ...
+    'approx', 0, 'epsilon', 0.01, 'delta', 0.1, 'samples', 0, 'seed', 0);
 options = merge_options(options,varargin{:});
 
 % edge_weights is an indicator that is 1 if we are using edge_weights
@@ -90,8 +109,13 @@ if ~weight_arg
 else
     weight_arg = 0;
 end
+mex_args = {A,weight_arg};
+if options.approx
+    mex_args{end+1} = [options.epsilon options.delta options.samples ...
+        options.seed];
+end
 if nargout > 1
-    [bc,ec] = betweenness_centrality_mex(A,weight_arg);
+    [bc,ec] = betweenness_centrality_mex(mex_args{:});
     
     [i j] = find(A);
     if ~trans
@@ -107,5 +131,5 @@ if nargout > 1
     end
     
 else
-    bc = betweenness_centrality_mex(A,weight_arg);
+    bc = betweenness_centrality_mex(mex_args{:});
 end
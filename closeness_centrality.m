@@ -0,0 +1,111 @@
+function [c,v,nsearched] = closeness_centrality(A,varargin)
+% CLOSENESS_CENTRALITY Compute closeness or harmonic centrality
+%
+% c = closeness_centrality(A) returns the closeness centrality of all 
+% vertices in A.  The closeness centrality of v is 
+%   c(v) = (r-1)^2/((n-1)*f) 
+% where r is the number of vertices reachable from v (including v) and f
+% is the sum of the shortest path distances from v to those vertices.
+% This is the Wasserman and Faust variant and is meaningful on 
+% disconnected graphs.  The harmonic centrality of v is the sum of 
+% 1/d(v,w) over all vertices w reachable from v.
+%
+% [c,v] = closeness_centrality(A,struct('topk',k)) returns the k vertices
+% v with the largest centrality and their centrality c in decreasing 
+% order.  The searches from vertices that cannot be in the top k stop 
+% early, which is much faster than computing all the values.  The third
+% output nsearched is the number of searches that were not stopped.
+%
+% The distances are computed with a breadth first search or Dijkstra's 
+% algorithm from each vertex in parallel, without forming the distance
+% matrix.  The distances are from v along the out-edges of A; use A' for
+% the distances to v.  The runtime is O(VE) for unweighted graphs and 
+% O(V(V+E)log(V)) for weighted graphs.
+%
+% ... = closeness_centrality(A,...) takes a set of
+% key-value pairs or an options structure.  See set_matlab_bgl_options
+% for the standard options. 
+%   options.type: the type of centrality [{'closeness'} | 'harmonic']
+%   options.topk: the number of top vertices to compute, or 0 for all 
+%       vertices [{0} | positive integer]
+%   options.unweighted: use the unweighted algorithm [{0} | 1]  
+%   options.edge_weight: a double array over the edges with an edge
+%       weight for each node, see EDGE_INDEX and EXAMPLES/REWEIGHTED_GRAPHS
+%       for information on how to use this option correctly
+%       [{'matrix'} | length(nnz(A)) double vector]
+%
+% Example:
+%    load graphs/padgett-florentine.mat
+%    closeness_centrality(A)
+%    [c,v] = closeness_centrality(A,struct('type','harmonic','topk',3))
+%
+% See also BETWEENNESS_CENTRALITY, ALL_SHORTEST_PATHS
+
+% David Gleich
+% Copyright, Stanford University, 2006-2008
+
+%% History
+%  2026-10-19: Initial version
+%%
+
+[trans check full2sparse] = get_matlab_bgl_options(varargin{:});
+if full2sparse && ~issparse(A), A = sparse(A); end
+
+options = struct('type', 'closeness', 'topk', 0, 'unweighted', 0, ...
+    'edge_weight', 'matrix');
+options = merge_options(options,varargin{:});
+
+% edge_weights is an indicator that is 1 if we are using edge_weights
+% passed on the command line or 0 if we are using the matrix.
+edge_weights = 0;
+edge_weight_opt = 'matrix';
+
+if strcmp(options.edge_weight, 'matrix')
+    % do nothing if we are using the matrix weights
+else
+    edge_weights = 1;
+    edge_weight_opt = options.edge_weight;
+end
+
+if check
+    % check the values
+    if options.unweighted ~= 1 && edge_weights ~= 1
+        check_matlab_bgl(A,struct('values',1,'noneg',1));
+    else
+        check_matlab_bgl(A,struct());
+    end
+    if edge_weights && any(edge_weight_opt < 0)
+        error('matlab_bgl:invalidParameter', ...
+                'the edge_weight array must be non-negative');
+    end
+end
+
+switch options.type
+    case 'closeness'
+        harmonic = 0;
+    case 'harmonic'
+        harmonic = 1;
+    otherwise
+        error('matlab_bgl:invalidParameter', ...
+            'type option %s is not supported', options.type);
+end
+
+if trans
+    A = A';
+end
+
+weight_arg = options.unweighted;
+if ~weight_arg
+    weight_arg = edge_weight_opt;
+else
+    weight_arg = 0;
+end
+
+if options.topk > 0
+    [c,v,nsearched] = closeness_centrality_mex(A,weight_arg,harmonic,...
+        options.topk);
+else
+    c = closeness_centrality_mex(A,weight_arg,harmonic,0);
+    v = (1:size(A,1))';
+    nsearched = size(A,1);
+end
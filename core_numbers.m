@@ -11,7 +11,11 @@ function [cn rt] = core_numbers(A,varargin)
 % To get the out-degree core numbers, call core_numbers(A').
 %
 % The runtime is O(E) for unweighted graphs and O((N+M) log N) for weighted
-% graphs.  The default is the *unweighted version* which ignores edge
+% graphs.  For non-negative integer weights, the weighted computation uses
+% a bucket queue and the runtime is O(N+M+W) where W is the largest 
+% weighted in-degree.  The removal times force a sequential algorithm, so when rt is 
+% not requested, the unweighted computation uses a parallel level 
+% synchronous algorithm instead.  The default is the *unweighted version* which ignores edge
 % weights.  For weighted graphs, the definition is the same, but the
 % in-degree is the weighted in-degree and is the sum of weight of 
 % incoming edges.
@@ -49,6 +53,8 @@ function [cn rt] = core_numbers(A,varargin)
 %  2007-07-30: Removed size option from output
 %    Added removal time output
 %  2008-10-07: Changed options parsing
+%  2026-10-19: Only compute removal times when requested
+%    Weighted core numbers no longer depend on the order of ties
 %%
 
 [trans check full2sparse] = get_matlab_bgl_options(varargin{:});
@@ -87,7 +93,11 @@ else
     weight_arg = 0;
 end
 
-[cn rt] = core_numbers_mex(A,weight_arg);
+if nargout > 1
+    [cn rt] = core_numbers_mex(A,weight_arg);
+else
+    cn = core_numbers_mex(A,weight_arg);
+end
 % if nargin > 2 && options.unweighted
 %     sizes = accumarray([cn+1 ones(length(cn),1)],1);
 % end
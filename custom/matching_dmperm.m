@@ -9,12 +9,16 @@ function [p,q,r,s]=matching_dmperm(A)
 % [p,q,r,s]=matching_dmperm(A) computes equivalent output to Matlab's
 % DMPERM function.
 %
+% The matching uses the Hopcroft-Karp algorithm on the bipartite graph
+% of the rows and columns of A.
+%
 % See also DMPERM, SPRANK
 
 [nr nc]=size(A);
 GA=spaugment(A,0);
 rv=1:nr; cv=nr+1:nr+nc;
-m=matching(GA);
+m=matching(GA,struct('augmenting_path','hopcroft_karp',...
+    'bipartition',[zeros(nr,1); ones(nc,1)]));
 cbar=find(m(cv)==0);
 rbar=find(m(rv)==0);
 d_cbar=setbfs(GA,cbar+nr);
@@ -0,0 +1,32 @@
+function [varargout]=dinic_max_flow(A,u,v,varargin)
+% DINIC_MAX_FLOW Dinic's max flow algorithm
+%
+% Dinic's algorithm augments the flow along a blocking flow of shortest
+% augmenting paths in each phase to compute a maximum flow or minimum cut
+% in a network.  It is much faster than the Edmunds-Karp algorithm on 
+% unit capacity and bipartite networks.
+%
+% See the max_flow function for calling information and return parameters.
+% This function just calls max_flow(...,struct('algname','dinic'));
+%
+% Example:
+%   load('graphs/max_flow_example.mat');
+%   dinic_max_flow(A,1,8)
+
+% David Gleich
+% Copyright, Stanford University, 2007-2008
+
+%% History
+%  2026-10-19: Initial version
+%%
+
+algname = 'dinic';
+if ~isempty(varargin), 
+    options = merge_options(struct(),varargin{:}); 
+    options.algname= algname;
+else options = struct('algname',algname); 
+end
+
+varargout = cell(1,max(nargout,1));
+
+[varargout{:}] = max_flow(A,u,v,options);
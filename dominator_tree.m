@@ -0,0 +1,68 @@
+function pred=dominator_tree(A,u,varargin)
+% DOMINATOR_TREE Compute dominator trees for a graph from a set of roots.
+%
+% A dominator tree encodes dominates relations.  A vertex u dominates a
+% vertex v if all paths from the root to v must go through u.  The
+% immediate dominator of v is the dominator of v closest to v, and these
+% form a tree rooted at the root.  
+%
+% p = dominator_tree(A,u) returns the predecessor array for the dominator
+% tree rooted at u, where p(v) = 0 if v = u or v is not reachable from u.
+% If u is a vector of roots, then p(k,:) is the predecessor array for the
+% dominator tree rooted at u(k).  All the roots share one transpose of A,
+% and the roots are split among OpenMP threads when libmbgl is compiled 
+% with OpenMP.
+%
+% The semi_nca algorithm computes the semidominators as in the
+% Lengauer-Tarjan algorithm and then the immediate dominators with nearest
+% common ancestor searches in the partial tree.  It is usually faster than
+% Lengauer-Tarjan in practice and the graph does not need to be reachable
+% from the root.  The runtime is O((V+E) log (V+E)) for each root and the
+% algorithm works on unweighted, directed graphs.
+%
+% ... = dominator_tree(A,...) takes a set of
+% key-value pairs or an options structure.  See set_matlab_bgl_options
+% for the standard options. 
+%   options.algname: the dominator tree algorithm 
+%       [{'semi_nca'} | 'lengauer_tarjan']
+%       The lengauer_tarjan algorithm only works with a single root.
+%
+% Note: this function does not depend upon the non-zero values of A, but
+% only uses the non-zero structure of A.
+%
+% Example:
+%   load('graphs/dominator_tree_example.mat');
+%   p=dominator_tree(A,1);
+%   P=dominator_tree(A,1:size(A,1)); % the dominator trees from every vertex
+%
+% See also LENGAUER_TARJAN_DOMINATOR_TREE
+
+% David Gleich
+% Copyright, Stanford University, 2007-2008
+
+%% History
+%  2026-10-19: Initial version
+%%
+
+[trans check full2sparse] = get_matlab_bgl_options(varargin{:});
+if full2sparse && ~issparse(A), A = sparse(A); end
+if check, check_matlab_bgl(A,struct()); end
+
+options = struct('algname', 'semi_nca');
+options = merge_options(options,varargin{:});
+
+switch options.algname
+    case 'semi_nca'
+        if trans, At = A; A = A'; else At = A'; end
+        pred = dominator_tree_mex(A,u,At)';
+    case 'lengauer_tarjan'
+        if numel(u) ~= 1
+            error('matlab_bgl:invalidParameter', ...
+                'the lengauer_tarjan algorithm requires a single root');
+        end
+        if trans, A = A'; end
+        pred = dominator_tree_mex(A,u);
+    otherwise
+        error('matlab_bgl:invalidParameter', ...
+            'algname option %s is not supported', options.algname);
+end
@@ -0,0 +1,62 @@
+function [value cut] = global_min_cut(A,varargin)
+% GLOBAL_MIN_CUT Compute a minimum cut of an undirected graph
+%
+% [value cut] = global_min_cut(A) returns the value of a minimum cut of 
+% the undirected graph A over all the partitions of the vertices into 
+% two non-empty sets, and the partition in cut, where cut(u) = 1 for the
+% vertices on one side and cut(u) = -1 for the vertices on the other 
+% side, the same as max_flow.  A graph with more than one connected 
+% component has a cut with value 0.
+%
+% The 'stoer_wagner' algorithm is deterministic and solves n-1 phases, 
+% each of which orders the vertices with a priority queue.  The 
+% 'karger_stein' algorithm is the randomized recursive contraction 
+% algorithm, which is faster on large dense graphs.  It returns a minimum
+% cut with high probability, and its trials run in parallel when libmbgl
+% is compiled with OpenMP.
+%
+% This method works on undirected graphs with non-negative edge weights.
+%
+% ... = global_min_cut(A,...) takes a set of
+% key-value pairs or an options structure.  See set_matlab_bgl_options
+% for the standard options. 
+%   options.algname: the min cut algorithm 
+%     [{'stoer_wagner'} | 'karger_stein']
+%   options.ntrials: the number of karger_stein trials, or 0 for 
+%     ceil(log2(n)^2) [{0} | positive integer]
+%   options.seed: the random seed for karger_stein [{0} | non-negative integer]
+%   options.fix_diag: remove any diagonal entries [0 | {1}]
+%
+% Note: the input to this function must be symmetric, so this function
+% ignores the 'notrans' default option and never transposes the input.
+%
+% Example:
+%    load('graphs/max_flow_example.mat')
+%    A = A + A';
+%    [value cut] = global_min_cut(A)
+%
+% See also MAX_FLOW, GOMORY_HU_TREE
+
+% David Gleich
+% Copyright, Stanford University, 2006-2008
+
+%% History
+%  2026-10-19: Initial version
+%%
+
+[trans check full2sparse] = get_matlab_bgl_options(varargin{:});
+if full2sparse && ~issparse(A), A = sparse(A); end
+if trans, end % no trans check
+
+options = struct('algname', 'stoer_wagner', 'ntrials', 0, 'seed', 0, ...
+    'fix_diag', 1);
+options = merge_options(options, varargin{:});
+
+if options.fix_diag, A = A - diag(diag(A)); end
+if check
+    % the matrix must be symmetric with non-negative weights
+    check_matlab_bgl(A,struct('sym',1,'values',1,'noneg',1,'nodiag',1));
+end
+
+[value cut] = global_min_cut_mex(A,lower(options.algname),...
+    options.ntrials,options.seed);
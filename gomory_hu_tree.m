@@ -0,0 +1,73 @@
+function [out1 out2 out3] = gomory_hu_tree(A,varargin)
+% GOMORY_HU_TREE Compute a Gomory-Hu cut tree of an undirected graph
+%
+% There are two ways to call GOMORY_HU_TREE.
+% T = gomory_hu_tree(A)
+% [i j v] = gomory_hu_tree(A)
+% The first call returns the cut tree T of the undirected graph A as a
+% symmetric matrix.  The second call returns the n-1 edges of the tree,
+% (i(k),j(k)) with value v(k).  The minimum cut between any two vertices
+% u and w of A is the smallest value on the path between u and w in the 
+% tree, and removing that tree edge splits the vertices into the two 
+% sides of a minimum cut.  Tree edges with value 0 are not in T, so use
+% the second call for disconnected graphs.
+%
+% The tree comes from Gusfield's algorithm, which solves n-1 max flow 
+% problems on A.  All the problems share one flow network in libmbgl, 
+% and when libmbgl is compiled with OpenMP, the next few problems are 
+% solved at the same time.
+%
+% This method works on undirected graphs with non-negative edge weights.
+%
+% ... = gomory_hu_tree(A,...) takes a set of
+% key-value pairs or an options structure.  See set_matlab_bgl_options
+% for the standard options. 
+%   options.algname: the max flow algorithm
+%     [{'push_relabel'} | 'kolmogorov' | 'parallel_push_relabel' | 
+%      'dinic' | 'pseudoflow']
+%   options.fix_diag: remove any diagonal entries [0 | {1}]
+%
+% Note: the input to this function must be symmetric, so this function
+% ignores the 'notrans' default option and never transposes the input.
+%
+% Example:
+%    load('graphs/max_flow_example.mat')
+%    A = A + A';
+%    T = gomory_hu_tree(A);
+%    [d dt pred] = bfs(T,1); p = path_from_pred(pred,8);
+%    min(T(sub2ind(size(T),p(1:end-1),p(2:end)))) % the min cut from 1 to 8
+%    max_flow(A,1,8)
+%
+% See also MAX_FLOW
+
+% David Gleich
+% Copyright, Stanford University, 2006-2008
+
+%% History
+%  2026-10-19: Initial version
+%%
+
+[trans check full2sparse] = get_matlab_bgl_options(varargin{:});
+if full2sparse && ~issparse(A), A = sparse(A); end
+if trans, end % no trans check
+
+options = struct('algname', 'push_relabel', 'fix_diag', 1);
+options = merge_options(options, varargin{:});
+
+if options.fix_diag, A = A - diag(diag(A)); end
+if check
+    % the matrix must be symmetric with non-negative weights
+    check_matlab_bgl(A,struct('sym',1,'values',1,'noneg',1,'nodiag',1));
+end
+
+[i j v] = gomory_hu_tree_mex(A,lower(options.algname));
+
+if nargout <= 1
+    T = sparse(i,j,v,size(A,1),size(A,1));
+    T = T + T';
+    out1 = T;
+else
+    out1 = i;
+    out2 = j;
+    out3 = v;
+end
@@ -3,3 +3,16 @@
 CCFILES="components.cc max_flow.cc orderings.cc searches.cc shortest_path.cc
 spanning_trees.cc statistics.cc layouts.cc planar.cc"
 
+
+# Print the flags to compile with OpenMP 3.1 if the compiler $1 supports
+# it, and nothing otherwise.  Without them, the parallel algorithms run
+# serially.  Set OPENMP_FLAGS to skip the test, e.g. OPENMP_FLAGS= for a
+# serial library.
+function openmp_flags {
+    if [ -n "${OPENMP_FLAGS+set}" ]; then
+        echo ${OPENMP_FLAGS}
+    elif printf '#if _OPENMP < 201107\n#error\n#endif\nint main() { return 0; }\n' \
+        | $1 -fopenmp -x c++ -o /dev/null - > /dev/null 2>&1; then
+        echo -fopenmp
+    fi
+}
@@ -6,15 +6,18 @@ YASMIC_DIR=.
 source ccfiles.sh
 OFILES=`echo ${CCFILES} | sed -e 's/\.cc/\.o/g'`
 
-CFLAGS="-O2 -c -I${BOOST_DIR} -I${YASMIC_DIR}"
-#CFLAGS="-g -c -I${BOOST_DIR} -I${YASMIC_DIR}"
+CXX=g++-3.3
+OPENMP=`openmp_flags ${CXX}`
+
+CFLAGS="-O2 -c -I${BOOST_DIR} -I${YASMIC_DIR} ${OPENMP}"
+#CFLAGS="-g -c -I${BOOST_DIR} -I${YASMIC_DIR} ${OPENMP}"
 function echocmd {
 	echo $@
 	$@
 }
 
 for file in ${CCFILES}; do
-	echocmd g++-3.3 $CFLAGS $file
+	echocmd ${CXX} $CFLAGS $file
 done
 
 echocmd ar rc libmbgl-linux-32.a ${OFILES} 
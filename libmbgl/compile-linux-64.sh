@@ -6,8 +6,11 @@ YASMIC_DIR=.
 source ccfiles.sh
 OFILES=`echo ${CCFILES} | sed -e 's/\.cc/\.o/g'`
 
-CFLAGS="-O2 -fPIC -c -I${BOOST_DIR} -I${YASMIC_DIR}"
-CFLAGS="-g -fPIC -c -I${BOOST_DIR} -I${YASMIC_DIR}"
+CXX=g++-3.4
+OPENMP=`openmp_flags ${CXX}`
+
+CFLAGS="-O2 -fPIC -c -I${BOOST_DIR} -I${YASMIC_DIR} ${OPENMP}"
+CFLAGS="-g -fPIC -c -I${BOOST_DIR} -I${YASMIC_DIR} ${OPENMP}"
 
 function echocmd {
 	echo $@
@@ -15,7 +18,7 @@ function echocmd {
 }
 
 for file in ${CCFILES}; do
-	echocmd g++-3.4 $CFLAGS $file
+	echocmd ${CXX} $CFLAGS $file
 done
 
 echocmd ar rc libmbgl-linux-64.a ${OFILES} 
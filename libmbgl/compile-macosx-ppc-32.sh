@@ -6,7 +6,10 @@ YASMIC_DIR=.
 source ccfiles.sh
 OFILES=`echo ${CCFILES} | sed -e 's/\.cc/\.o/g'`
 
-CFLAGS="-O2 -c -I${BOOST_DIR} -I${YASMIC_DIR}"
+CXX=g++
+OPENMP=`openmp_flags ${CXX}`
+
+CFLAGS="-O2 -c -I${BOOST_DIR} -I${YASMIC_DIR} ${OPENMP}"
 
 function echocmd {
 	echo $@
@@ -14,7 +17,7 @@ function echocmd {
 }
 
 for file in ${CCFILES}; do
-	echocmd g++ $CFLAGS $file
+	echocmd ${CXX} $CFLAGS $file
 done
 
 echocmd ar rc libmbgl-macosx-ppc-32.a ${OFILES} 
@@ -13,7 +13,13 @@ set OUTDIR=Release\\
 set YASMICDIR=.
 set BOOSTDIR=e:\dev\lib\boost_1_36_0
 
-set CFLAGS=-c -nologo -I"%YASMICDIR%" -I"%BOOSTDIR%" /Fo"%OUTDIR%\\" /EHsc /D "NDEBUG" /O2 /ML
+rem % OpenMP 3.1 runs the parallel algorithms on all the cores.  The plain
+rem % /openmp switch only implements OpenMP 2.0, so use the LLVM runtime from
+rem % Visual Studio 2019 and later.  Older compilers ignore the switch with
+rem % warning D9002 and build a serial library; set OMPFLAGS= to silence it.
+set OMPFLAGS=/openmp:llvm
+
+set CFLAGS=-c -nologo -I"%YASMICDIR%" -I"%BOOSTDIR%" /Fo"%OUTDIR%\\" /EHsc /D "NDEBUG" /O2 /ML %OMPFLAGS%
 rem set CFLAGS=-c -nologo -Ie:\dev\yasmic -Ie:\dev\lib\boost_1_33_1 /Fo"%OUTDIR%\\" /EHsc /ML /Od /D "_DEBUG" /Fd"%OUTDIR%\vc70.pdb" /Zi
 set LIBFLAGS=-nologo /out:"%OUTDIR%\\%LIBNAME%"
 
@@ -19,7 +19,13 @@ set OUTDIR=Release\\
 set YASMICDIR=.
 set BOOSTDIR=C:\dev\boost_1_36_0
 
-set CFLAGS=/c /nologo /I"%YASMICDIR%" /I"%BOOSTDIR%" /Fo"%OUTDIR%" /EHsc /DNDEBUG /DMATLAB_BGL_LARGE_ARRAYS /O2 
+rem % OpenMP 3.1 runs the parallel algorithms on all the cores.  The plain
+rem % /openmp switch only implements OpenMP 2.0, so use the LLVM runtime from
+rem % Visual Studio 2019 and later.  Older compilers ignore the switch with
+rem % warning D9002 and build a serial library; set OMPFLAGS= to silence it.
+set OMPFLAGS=/openmp:llvm
+
+set CFLAGS=/c /nologo /I"%YASMICDIR%" /I"%BOOSTDIR%" /Fo"%OUTDIR%" /EHsc /DNDEBUG /DMATLAB_BGL_LARGE_ARRAYS /O2 %OMPFLAGS%
 set LIBFLAGS=-nologo /out:"%OUTDIR%\\%LIBNAME%"
 
 rem Make sure the release directory exists
@@ -112,12 +112,119 @@ int kolmogorov_max_flow(
     int* cap, int* res, /* capacity and residual capacity */
     mbglIndex* rev_edge_index, int *flow);
 
+int dinic_max_flow(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,  /* connectivity params */
+    mbglIndex src, mbglIndex sink, /* flow data */
+    int* cap, int* res, /* capacity and residual capacity */
+    mbglIndex* rev_edge_index, int *flow);
+
+int kolmogorov_max_flow_double(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,  /* connectivity params */
+    mbglIndex src, mbglIndex sink, /* flow data */
+    double* cap, double* res, /* capacity and residual capacity */
+    mbglIndex* rev_edge_index, double *flow);
+
+int dinic_max_flow_double(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,  /* connectivity params */
+    mbglIndex src, mbglIndex sink, /* flow data */
+    double* cap, double* res, /* capacity and residual capacity */
+    mbglIndex* rev_edge_index, double *flow);
+
+int pseudoflow_max_flow(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,  /* connectivity params */
+    mbglIndex src, mbglIndex sink, /* flow data */
+    int* cap, int* res, /* capacity and residual capacity */
+    mbglIndex* rev_edge_index, int *flow);
+
+int pseudoflow_max_flow_double(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,  /* connectivity params */
+    mbglIndex src, mbglIndex sink, /* flow data */
+    double* cap, double* res, /* capacity and residual capacity */
+    mbglIndex* rev_edge_index, double *flow);
+
 int edmunds_karp_max_flow(
     mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,  /* connectivity params */
     mbglIndex src, mbglIndex sink, /* flow data */
     int* cap, int* res, /* capacity and residual capacity */
     mbglIndex* rev_edge_index, int *flow);
 
+int parallel_push_relabel_max_flow(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,  /* connectivity params */
+    mbglIndex src, mbglIndex sink, /* flow data */
+    int* cap, int* res, /* capacity and residual capacity */
+    mbglIndex* rev_edge_index, int *flow);
+
+int parallel_push_relabel_max_flow_double(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,  /* connectivity params */
+    mbglIndex src, mbglIndex sink, /* flow data */
+    double* cap, double* res, /* capacity and residual capacity */
+    mbglIndex* rev_edge_index, double *flow);
+
+typedef struct flow_network flow_network;
+
+int create_flow_network(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,  /* connectivity params */
+    flow_network **net);
+
+int free_flow_network(flow_network *net);
+
+int flow_network_max_flow(
+    flow_network *net, double *cap, /* capacity of each edge */
+    mbglIndex nsources, mbglIndex *sources, double *source_cap,
+    mbglIndex nsinks, mbglIndex *sinks, double *sink_cap,
+    int algorithm, int *flow, int *mincut, double *res);
+
+int flow_network_max_flow_double(
+    flow_network *net, double *cap, /* capacity of each edge */
+    mbglIndex nsources, mbglIndex *sources, double *source_cap,
+    mbglIndex nsinks, mbglIndex *sinks, double *sink_cap,
+    int algorithm, double *flow, int *mincut, double *res);
+
+typedef struct parametric_max_flow parametric_max_flow;
+
+int create_parametric_max_flow(
+    flow_network *net, double *cap, /* capacity of each edge */
+    parametric_max_flow **pf);
+
+int free_parametric_max_flow(parametric_max_flow *pf);
+
+int parametric_max_flow_update(
+    parametric_max_flow *pf, double *source_cap, double *sink_cap,
+    double *flow, int *mincut);
+
+int gomory_hu_tree(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
+    double *weight, int algorithm, /* edge weights and flow algorithm */
+    mbglIndex *i, mbglIndex *j, double *val /* tree edges and cut values */
+    );
+
+int multiway_cut(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
+    double *weight, mbglIndex nterms, mbglIndex *terms, /* problem data */
+    int algorithm, /* max flow algorithm */
+    mbglIndex *labels, int *cut, /* output: terminal labels and cut edges */
+    double *isolating, double *value /* output: isolating and total cut */
+    );
+
+int flow_improve(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
+    double *weight, double *p, int *set, /* edge and vertex weights, set */
+    int mqi, mbglIndex maxiter, /* method and iterations */
+    int *improved, double *cond, mbglIndex *niter /* output: set, history */
+    );
+
+int stoer_wagner_min_cut(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
+    double *weight, /* edge weights */
+    double *value, int *side /* output: cut value and partition */
+    );
+
+int karger_stein_min_cut(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
+    double *weight, mbglIndex ntrials, unsigned int seed, /* problem data */
+    double *value, int *side /* output: cut value and partition */
+    );
+
 /**
  * @section searches.cc
  */
@@ -233,6 +340,15 @@ int prim_mst_rooted(
     mbglIndex* i, mbglIndex* j, double* val, mbglIndex* nedges, /* tree output */
     mbglIndex root);
 
+int boruvka_mst(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, double *weight, /* connectivity params */
+    mbglIndex* i, mbglIndex* j, double* val, mbglIndex* nedges /* tree output */);
+
+int filter_kruskal_mst(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, double *weight, /* connectivity params */
+    mbglIndex* i, mbglIndex* j, double* val, mbglIndex* ei, /* tree output */
+    mbglIndex* nedges);
+
 /**
  * @section statistics.cc
  *
@@ -241,6 +357,31 @@ int betweenness_centrality(
     mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, double *weight, /* connectivity params */
     double *centrality, double *ecentrality);
 
+int approximate_betweenness_centrality(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, double *weight, /* connectivity params */
+    double epsilon, double delta, mbglIndex max_samples, unsigned int seed,
+    double *centrality, double *ecentrality, mbglIndex *nsamples);
+
+int closeness_centrality(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, double *weight, /* connectivity params */
+    int harmonic, double *centrality);
+
+int top_k_closeness_centrality(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, double *weight, /* connectivity params */
+    int harmonic, mbglIndex k, mbglIndex *topk, double *scores,
+    mbglIndex *nsearched);
+
+int pagerank(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, double *weight, /* connectivity params */
+    double alpha, double *v, double tol, mbglIndex maxiter,
+    double *x, mbglIndex *niter, double *residual);
+
+int local_pagerank(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
+    double alpha, mbglIndex nseeds, mbglIndex *seeds, double eps,
+    mbglIndex maxnz, mbglIndex *pi, double *pv, mbglIndex *nnz,
+    int sweep, mbglIndex *bestsize, double *bestcond, mbglIndex *npushes);
+
 int clustering_coefficients(
     mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
     double *ccoeffs, int directed);
@@ -253,6 +394,11 @@ int directed_clustering_coefficients(
     mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, double *weight, /* connectivity params */
     double *ccoeffs);
 
+int sampled_clustering_coefficients(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
+    int global, mbglIndex nsamples, double tol, double conf,
+    unsigned int seed, double *cc, double *ci, mbglIndex *nsamples_used);
+
 int topological_order(
     mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
     mbglIndex *rev_order, int *is_dag);
@@ -262,6 +408,14 @@ int maximum_cardinality_matching(
     mbglIndex* mate, int initial_matching, int augmenting_path, int verify,
     int *verified, mbglIndex *null_vertex);
 
+int bipartite_matching(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
+    int *side, mbglIndex* mate, mbglIndex *null_vertex);
+
+int approximate_weighted_matching(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, double *weight,
+    mbglIndex *mate, double *matching_weight, mbglIndex *null_vertex);
+
 int test_maximum_cardinality_matching(
     mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
     mbglIndex* mate, int *verified);
@@ -270,14 +424,39 @@ int core_numbers(
     mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
     mbglDegreeType *cn, int *rt);
 
+int update_core_numbers(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
+    mbglIndex ninsert, mbglIndex *insert_i, mbglIndex *insert_j,
+    mbglIndex ndelete, mbglIndex *delete_i, mbglIndex *delete_j,
+    mbglDegreeType *cn, mbglIndex *nvisited);
+
 int weighted_core_numbers(
     mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, double *weight, /* connectivity params */
     double *cn, int *rt);
 
+int triangle_counts(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
+    mbglDegreeType *support, double *ntriangles);
+
+int triangle_list(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
+    int (*tri)(void *pdata, mbglIndex u, mbglIndex v, mbglIndex w,
+        mbglIndex euv, mbglIndex evw, mbglIndex euw),
+    void *pdata);
+
+int truss_numbers(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
+    mbglDegreeType *truss);
+
 int dominator_tree(
     mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,
     mbglIndex src, mbglIndex *pred);
 
+int dominator_trees(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,
+    mbglIndex *atj, mbglIndex *ati,
+    mbglIndex nroots, mbglIndex *roots, mbglIndex *pred);
+
 /**
  * @section layouts.cc
  * Prototypes for layouts.cc
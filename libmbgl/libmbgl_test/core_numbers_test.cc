@@ -120,6 +120,53 @@ int test_3() {
     return 0;
 }    
 
+int test_4() {
+    // the weighted core numbers do not depend on the queue
+    typedef adjacency_list < vecS, vecS, undirectedS,
+        no_property, property < edge_weight_t, int > > graph_t;
+    int num_nodes = 21;
+    graph_t G(num_nodes);
+    int edges[][2] = {{0,1},{1,2},{1,3},{2,3},{1,4},{3,4},{4,5},{4,6},
+        {5,6},{4,7},{5,7},{6,7},{7,8},{3,9},{8,9},{8,10},{9,10},{10,11},
+        {10,12},{3,13},{9,13},{3,14},{9,14},{13,14},{16,17},{16,18},
+        {17,19},{18,19},{19,20}};
+    int num_arcs = sizeof(edges)/sizeof(edges[0]);
+    for (int i=0; i<num_arcs; ++i) {
+        add_edge(edges[i][0], edges[i][1], (edges[i][0]+edges[i][1])%3+1, G);
+    }
+    
+    typedef iterator_property_map<std::vector<int>::iterator,
+        property_map<graph_t, vertex_index_t>::type> core_map;
+    std::vector<int> cn1(num_nodes), cn2(num_nodes), cn3(num_nodes);
+    core_map c1(cn1.begin(), get(vertex_index,G));
+    core_map c2(cn2.begin(), get(vertex_index,G));
+    core_map c3(cn3.begin(), get(vertex_index,G));
+    weighted_core_numbers(G, c1);
+    
+    detail::indexed_d_ary_heap<graph_traits<graph_t>::vertex_descriptor,
+        core_map, property_map<graph_t, vertex_index_t>::type>
+        heap(num_nodes, c2, get(vertex_index,G));
+    core_numbers_with_queue(G, c2, get(edge_weight,G), get(vertex_index,G),
+        heap, make_core_numbers_visitor(null_visitor()));
+    
+    detail::integer_bucket_queue<graph_traits<graph_t>::vertex_descriptor,
+        core_map, property_map<graph_t, vertex_index_t>::type>
+        buckets(num_nodes, c3, get(vertex_index,G));
+    core_numbers_with_queue(G, c3, get(edge_weight,G), get(vertex_index,G),
+        buckets, make_core_numbers_visitor(null_visitor()));
+    
+    for (size_t i=0; i<num_vertices(G); ++i) {
+        printf("vertex %3zu : %i %i %i\n", i, cn1[i], cn2[i], cn3[i]);
+    }
+    
+    for (size_t i=0; i<num_vertices(G); ++i) {
+        if (cn1[i] != cn2[i] || cn1[i] != cn3[i]) {
+            return 1; // error!
+        }
+    }
+    return 0;
+}
+
 int main(int argc, char **argv) {
   int nfail = 0, ntotal = 0;
   int rval;
@@ -140,6 +187,11 @@ int main(int argc, char **argv) {
   rval= test_3(); ntotal++;
   if (rval!= 0) { nfail++; printf("%20s  %50s\n", name, errstr); }
   else { printf("%20s  success\n", name); }
+  
+  name= "weighted_core_queues";
+  rval= test_4(); ntotal++;
+  if (rval!= 0) { nfail++; printf("%20s  %50s\n", name, errstr); }
+  else { printf("%20s  success\n", name); }
 
   printf("\n");
   printf("Total tests  : %3i\n", ntotal);
@@ -10,5 +10,6 @@ const char* errstr = "";
 int main(int argc, char **argv) {
   layout_funcs_test();
   planar_funcs_test();
+  statistics_funcs_test();
   return 0;
 }
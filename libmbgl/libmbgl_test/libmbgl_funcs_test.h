@@ -1,4 +1,5 @@
 extern const char* errstr;
 int planar_funcs_test();
 int layout_funcs_test();
+int statistics_funcs_test();
 
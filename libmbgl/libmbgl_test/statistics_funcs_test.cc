@@ -0,0 +1,64 @@
+#include <include/matlab_bgl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include "libmbgl_funcs_test.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif /* _OPENMP */
+
+int test_core_numbers_1() {
+  // the parallel core numbers of a dense random graph match the serial
+  // ones with many threads decrementing the same vertices
+  const mbglIndex n = 400;
+  std::vector<mbglIndex> rp(n+1,0), ci;
+  std::vector<char> adj(n*n,0);
+  srand(0);
+  for (mbglIndex i=0; i<n; i++) {
+    for (mbglIndex j=i+1; j<n; j++) {
+      if (rand() % 4 != 0) { adj[i*n+j] = 1; adj[j*n+i] = 1; }
+    }
+  }
+  for (mbglIndex i=0; i<n; i++) {
+    for (mbglIndex j=0; j<n; j++) { if (adj[i*n+j]) { ci.push_back(j); } }
+    rp[i+1] = (mbglIndex)ci.size();
+  }
+  std::vector<mbglDegreeType> cn(n), cnp(n);
+  std::vector<int> rt(n);
+  int rval;
+#ifdef _OPENMP
+  int nthreads = omp_get_max_threads();
+  omp_set_num_threads(nthreads < 8 ? 8 : nthreads);
+#endif /* _OPENMP */
+  rval= core_numbers(n, &ci[0], &rp[0], &cn[0], &rt[0]);
+  if (rval!=0) { errstr = "function error"; return -1; }
+  for (int trial=0; trial<20; trial++) {
+    rval= core_numbers(n, &ci[0], &rp[0], &cnp[0], NULL);
+    if (rval!=0) { errstr = "function error"; return -1; }
+    for (mbglIndex i=0; i<n; i++) {
+      if (cn[i] != cnp[i]) { errstr = "parallel core numbers differ"; return -1; }
+    }
+  }
+#ifdef _OPENMP
+  omp_set_num_threads(nthreads);
+#endif /* _OPENMP */
+  return 0;
+}
+
+int statistics_funcs_test() 
+{
+  int nfail= 0, ntotal= 0, rval;
+  const char* name;
+
+  name= "parallel core_numbers";
+  rval= test_core_numbers_1(); ntotal++;
+  if (rval!= 0) { nfail++; printf("%20s  %50s\n", name, errstr); }
+  else { printf("%20s  success\n", name); }
+   
+  printf("\n");
+  printf("Total tests  : %3i\n", ntotal);
+  printf("Total failed : %3i\n", nfail);
+
+  return nfail!=0;
+}
@@ -0,0 +1,99 @@
+/** @file weighted_core_numbers_bench.cc
+ * @copyright Stanford University, 2008
+ * Benchmark the queues for the weighted core numbers.
+ *
+ * Usage: weighted_core_numbers_bench [nverts] [avgdeg] [maxweight]
+ *
+ * The graph is a symmetric random graph with integer weights between 1
+ * and maxweight.  We time the original mutable_queue, the indexed 4-ary
+ * heap, and (for integer weights) the bucket queue, and check that the
+ * core numbers match.
+ */
+
+/** History
+ *  2026-10-19: Initial version
+ */
+
+#include <vector>
+#include <algorithm>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <yasmic/simple_csr_matrix_as_graph.hpp>
+#include <yasmic/boost_mod/core_numbers.hpp>
+#include <boost/property_map.hpp>
+
+using namespace boost;
+
+typedef yasmic::simple_csr_matrix<int,double> crs_graph;
+typedef iterator_property_map<double*, identity_property_map> core_map;
+
+double elapsed(clock_t t0) {
+    return (double)(clock()-t0)/(double)CLOCKS_PER_SEC;
+}
+
+int main(int argc, char **argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    int avgdeg = argc > 2 ? atoi(argv[2]) : 8;
+    int maxweight = argc > 3 ? atoi(argv[3]) : 10;
+
+    // build a symmetric random graph
+    srand(0);
+    std::vector< std::pair<int,int> > edges;
+    for (int i=0; i<n; ++i) {
+        for (int k=0; k<avgdeg/2; ++k) {
+            int j = rand()%n;
+            if (i == j) { continue; }
+            edges.push_back(std::make_pair(i,j));
+            edges.push_back(std::make_pair(j,i));
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+    int nz = (int)edges.size();
+    std::vector<int> ia(n+1), ja(nz);
+    std::vector<double> a(nz);
+    for (int k=0; k<nz; ++k) {
+        ++ia[edges[k].first+1];
+        ja[k] = edges[k].second;
+        // symmetric weights
+        int lo = (std::min)(edges[k].first, edges[k].second);
+        int hi = (std::max)(edges[k].first, edges[k].second);
+        a[k] = 1 + (lo*31 + hi*17)%maxweight;
+    }
+    for (int i=0; i<n; ++i) { ia[i+1] += ia[i]; }
+
+    crs_graph g(n, n, nz, &ia[0], &ja[0], &a[0]);
+    std::vector<double> cn1(n), cn2(n), cn3(n);
+    printf("nverts = %i, nnz = %i, max weight = %i\n", n, nz, maxweight);
+
+    clock_t t0 = clock();
+    core_numbers(g, core_map(&cn1[0]), get(edge_weight,g),
+        get(vertex_index,g), make_core_numbers_visitor(null_visitor()));
+    printf("%20s : %8.3f s\n", "mutable_queue", elapsed(t0));
+
+    t0 = clock();
+    detail::indexed_d_ary_heap<int, core_map, identity_property_map>
+        heap(n, core_map(&cn2[0]), get(vertex_index,g));
+    core_numbers_with_queue(g, core_map(&cn2[0]), get(edge_weight,g),
+        get(vertex_index,g), heap, make_core_numbers_visitor(null_visitor()));
+    printf("%20s : %8.3f s\n", "indexed_d_ary_heap", elapsed(t0));
+
+    t0 = clock();
+    detail::integer_bucket_queue<int, core_map, identity_property_map>
+        buckets(n, core_map(&cn3[0]), get(vertex_index,g));
+    core_numbers_with_queue(g, core_map(&cn3[0]), get(edge_weight,g),
+        get(vertex_index,g), buckets, make_core_numbers_visitor(null_visitor()));
+    printf("%20s : %8.3f s\n", "integer_bucket_queue", elapsed(t0));
+
+    int ndiff2 = 0, ndiff3 = 0;
+    for (int i=0; i<n; ++i) {
+        if (cn1[i] != cn2[i]) { ++ndiff2; }
+        if (cn1[i] != cn3[i]) { ++ndiff3; }
+    }
+    printf("vertices with different core numbers: heap %i, buckets %i\n",
+        ndiff2, ndiff3);
+
+    return (ndiff2 != 0 || ndiff3 != 0);
+}
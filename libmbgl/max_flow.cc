@@ -19,6 +19,17 @@
  *
  * 9 July 2007
  * Switched to simple_csr_matrix graph type
+ *
+ * 19 October 2026
+ * Added a reusable flow network with terminal capacities
+ * Added a parallel push relabel max flow
+ * Added dinic_max_flow and double capacities
+ * Added a parametric max flow that keeps the preflow
+ * Added a pseudoflow max flow
+ * Added a Gomory-Hu tree
+ * Added a multiway cut from isolating cuts
+ * Added FlowImprove and MQI
+ * Added Stoer-Wagner and Karger-Stein minimum cuts
  */
 
 #include "include/matlab_bgl.h"
@@ -27,8 +38,20 @@
 #include <boost/graph/push_relabel_max_flow.hpp>
 #include <boost/graph/edmunds_karp_max_flow.hpp>
 #include <yasmic/boost_mod/kolmogorov_max_flow.hpp>
+#include <yasmic/boost_mod/core_numbers.hpp>
 #include <yasmic/iterator_utility.hpp>
 #include <boost/property_map.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real.hpp>
+
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <math.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif /* _OPENMP */
 
 template <typename Index, typename Value, typename EdgeIndex, class Child>
 struct reverse_edge_pmap_helper
@@ -195,6 +218,27 @@ int edmunds_karp_max_flow(
     return (0);
 }
 
+template <typename Capacity>
+Capacity kolmogorov_max_flow_help(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,
+    mbglIndex src, mbglIndex sink,
+    Capacity* cap, Capacity* res,
+    mbglIndex* rev_edge_index)
+{
+    using namespace yasmic;
+    using namespace boost;
+
+    typedef simple_csr_matrix<mbglIndex,double> crs_graph;
+    crs_graph g(nverts, nverts, ia[nverts], ia, ja, NULL);
+
+    return (kolmogorov_max_flow(g,
+        make_iterator_property_map(cap, get(edge_index,g)),
+        make_iterator_property_map(res, get(edge_index,g)),
+        make_reverse_edge_pmap(g,rev_edge_index),
+        get(vertex_index,g),
+        src, sink));
+}
+
 /**
  * Wrap the boost graph library class for a Kolmogorov max flow computation.
  *
@@ -225,26 +269,2109 @@ int kolmogorov_max_flow(
     mbglIndex* rev_edge_index,
     int* flow)
 {
-    using namespace yasmic;
-    using namespace boost;
-
-    typedef simple_csr_matrix<mbglIndex,double> crs_graph;
-    crs_graph g(nverts, nverts, ia[nverts], ia, ja, NULL);
-
-    *flow = (kolmogorov_max_flow(g,
-        make_iterator_property_map(cap, get(edge_index,g)),
-        make_iterator_property_map(res, get(edge_index,g)),
-        make_reverse_edge_pmap(g,rev_edge_index),
-        get(vertex_index,g),
-        src, sink));
+    *flow = kolmogorov_max_flow_help(nverts, ja, ia, src, sink, 
+        cap, res, rev_edge_index);
     /*test_kolmogorov(g,
         make_iterator_property_map(cap, get(edge_index,g)),
         make_iterator_property_map(res, get(edge_index,g)),
         make_reverse_edge_pmap(g,rev_edge_index));*/
 
+    return (0);
+}
+
+/**
+ * The Kolmogorov max flow computation with double capacities.
+ *
+ * See kolmogorov_max_flow for the arguments.
+ */
+int kolmogorov_max_flow_double(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,
+    mbglIndex src, mbglIndex sink,
+    double* cap, double* res,
+    mbglIndex* rev_edge_index,
+    double* flow)
+{
+    *flow = kolmogorov_max_flow_help(nverts, ja, ia, src, sink, 
+        cap, res, rev_edge_index);
+    return (0);
+}
+
+/**
+ * The state of a Dinic max flow computation.
+ *
+ * Each phase computes the breadth first search levels from the source in
+ * the residual graph and then a blocking flow along the edges that go up
+ * one level.  The blocking flow uses a current arc for each vertex, so 
+ * each edge is scanned once per phase unless it is on an augmenting path.
+ */
+template <typename Capacity>
+struct dinic_max_flow_state
+{
+    dinic_max_flow_state(mbglIndex nverts_, mbglIndex *ja_, mbglIndex *ia_,
+        Capacity *res_, mbglIndex *rev_)
+        : nverts(nverts_), ja(ja_), ia(ia_), res(res_), rev(rev_),
+          level(nverts_), current(nverts_), queue(nverts_)
+    {}
+
+    /** Compute the levels from the source
+     * @return true if the sink is reachable in the residual graph
+     */
+    bool levels(mbglIndex src, mbglIndex sink)
+    {
+        const mbglIndex none = nverts;
+        std::fill(level.begin(), level.end(), none);
+        mbglIndex qhead = 0, qtail = 0;
+        level[src] = 0;
+        queue[qtail++] = src;
+        while (qhead != qtail) {
+            mbglIndex u = queue[qhead++];
+            for (mbglIndex k=ia[u]; k<ia[u+1]; ++k) {
+                mbglIndex v = ja[k];
+                if (res[k] > 0 && level[v] == none) {
+                    level[v] = level[u]+1;
+                    queue[qtail++] = v;
+                }
+            }
+        }
+        return (level[sink] != none);
+    }
+
+    /** Compute a blocking flow with an iterative depth first search.
+     * @return the value of the blocking flow
+     */
+    Capacity blocking_flow(mbglIndex src, mbglIndex sink)
+    {
+        const mbglIndex none = nverts;
+        Capacity total = 0;
+        for (mbglIndex v=0; v<nverts; ++v) { current[v] = ia[v]; }
+        path.clear();
+        mbglIndex u = src;
+        while (1) {
+            if (u == sink) {
+                // augment along the path and retreat to the tail of the 
+                // first saturated edge
+                Capacity delta = res[path[0]];
+                for (size_t i=1; i<path.size(); ++i) {
+                    if (res[path[i]] < delta) { delta = res[path[i]]; }
+                }
+                size_t first = path.size();
+                for (size_t i=0; i<path.size(); ++i) {
+                    mbglIndex k = path[i];
+                    res[k] -= delta;
+                    res[rev[k]] += delta;
+                    if (res[k] == 0 && first == path.size()) { first = i; }
+                }
+                total += delta;
+                path.resize(first);
+                u = first == 0 ? src : ja[path[first-1]];
+                continue;
+            }
+            mbglIndex k = current[u];
+            for (; k<ia[u+1]; ++k) {
+                mbglIndex v = ja[k];
+                if (res[k] > 0 && level[v] == level[u]+1) { break; }
+            }
+            current[u] = k;
+            if (k < ia[u+1]) {
+                path.push_back(k);
+                u = ja[k];
+            } else {
+                // u is a dead end for this phase
+                level[u] = none;
+                if (path.empty()) { break; }
+                k = path.back();
+                path.pop_back();
+                u = ja[rev[k]];
+                ++current[u];
+            }
+        }
+        return (total);
+    }
+
+    mbglIndex nverts;
+    mbglIndex *ja, *ia;
+    Capacity *res;
+    mbglIndex *rev;
+    std::vector<mbglIndex> level, current, queue, path;
+};
+
+template <typename Capacity>
+Capacity dinic_max_flow_help(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,
+    mbglIndex src, mbglIndex sink,
+    Capacity* cap, Capacity* res,
+    mbglIndex* rev_edge_index)
+{
+    mbglIndex nz = ia[nverts];
+    for (mbglIndex k=0; k<nz; ++k) { res[k] = cap[k]; }
+
+    dinic_max_flow_state<Capacity> dinic(nverts, ja, ia, res, rev_edge_index);
+    Capacity flow = 0;
+    while (dinic.levels(src, sink)) {
+        flow += dinic.blocking_flow(src, sink);
+    }
+    return (flow);
+}
+
+/**
+ * A Dinic max flow computation.
+ *
+ * Dinic's algorithm augments along blocking flows of shortest augmenting
+ * paths and is much faster than the Edmunds-Karp algorithm on unit 
+ * capacity and bipartite networks.
+ *
+ * The arguments are the same as push_relabel_max_flow.
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex
+ * @param ia the row connectivity points into ja
+ * @param src the source vertex for the flow
+ * @param sink the sink vertex for the flow
+ * @param cap the array of capacities for each edge
+ * @param res the array of residual capacities for each edge
+ * @param rev_edge_index an array indicating the index of the reverse edge
+ * for the edge with the current index
+ * @param flow the maximum flow in the graph
+ * @return an error code if possible
+ */
+int dinic_max_flow(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,
+    mbglIndex src, mbglIndex sink,
+    int* cap, int* res,
+    mbglIndex* rev_edge_index,
+    int* flow)
+{
+    if (src >= nverts || sink >= nverts || src == sink) { return (-1); }
+    *flow = dinic_max_flow_help(nverts, ja, ia, src, sink, 
+        cap, res, rev_edge_index);
+    return (0);
+}
+
+/**
+ * The Dinic max flow computation with double capacities.
+ *
+ * See dinic_max_flow for the arguments.
+ */
+int dinic_max_flow_double(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,
+    mbglIndex src, mbglIndex sink,
+    double* cap, double* res,
+    mbglIndex* rev_edge_index,
+    double* flow)
+{
+    if (src >= nverts || sink >= nverts || src == sink) { return (-1); }
+    *flow = dinic_max_flow_help(nverts, ja, ia, src, sink, 
+        cap, res, rev_edge_index);
+    return (0);
+}
+
+
+
+/**
+ * The state of a parallel push-relabel max-flow computation.
+ *
+ * The pushes follow the lock-free algorithm of Hong: a vertex pushes to 
+ * its lowest neighbor in the residual graph if it is higher than that
+ * neighbor and relabels itself otherwise.  The excess and residual 
+ * capacities change with atomic updates and the labels only increase, 
+ * so the pushes from different threads never need a lock.  Each round 
+ * discharges all the active vertices in parallel.  Between rounds, a 
+ * level synchronous breadth first search from the target computes exact
+ * labels (global relabeling) and labels the vertices that cannot reach
+ * the target with nverts, which includes the gap heuristic.
+ */
+template <typename Capacity>
+struct parallel_push_relabel
+{
+    parallel_push_relabel(mbglIndex nverts_, mbglIndex *ja_, mbglIndex *ia_,
+        Capacity *res_, mbglIndex *rev_)
+        : nverts(nverts_), ja(ja_), ia(ia_), res(res_), rev(rev_),
+          excess(nverts_,0), label(nverts_,0), queued(nverts_,0)
+    {}
+
+    /** Compute exact labels with a breadth first search from the target
+     * along the reverse residual edges.
+     */
+    void global_relabel(mbglIndex target, mbglIndex other)
+    {
+        const mbglIndex inf = nverts;
+        for (mbglIndex v=0; v<nverts; ++v) { label[v] = inf; }
+        label[target] = 0;
+        std::vector<mbglIndex> frontier(1,target);
+        for (mbglIndex level=1; !frontier.empty(); ++level) {
+            std::vector<mbglIndex> next;
+            ptrdiff_t nfrontier = (ptrdiff_t)frontier.size();
+            #pragma omp parallel if (nfrontier > 256)
+            {
+                std::vector<mbglIndex> local;
+                #pragma omp for schedule(dynamic, 64)
+                for (ptrdiff_t i=0; i<nfrontier; ++i) {
+                    mbglIndex u = frontier[i];
+                    for (mbglIndex k=ia[u]; k<ia[u+1]; ++k) {
+                        mbglIndex w = ja[k];
+                        if (w == other || res[rev[k]] <= 0) { continue; }
+                        // every thread in this level writes the same label
+                        mbglIndex old;
+                        #pragma omp atomic read
+                        old = label[w];
+                        if (old != inf) { continue; }
+                        #pragma omp atomic capture
+                        { old = label[w]; label[w] = level; }
+                        if (old == inf) { local.push_back(w); }
+                    }
+                }
+                #pragma omp critical
+                next.insert(next.end(), local.begin(), local.end());
+            }
+            frontier.swap(next);
+        }
+        label[other] = inf;
+    }
+
+    /** Discharge the vertex v until it has no excess or cannot reach the
+     * target.
+     *
+     * @return the number of relabels
+     */
+    mbglIndex discharge(mbglIndex v, mbglIndex target, mbglIndex other,
+        std::vector<mbglIndex>& next)
+    {
+        const mbglIndex inf = nverts;
+        mbglIndex nrelabels = 0;
+        while (1) {
+            Capacity e;
+            #pragma omp atomic read
+            e = excess[v];
+            if (e <= 0) { break; }
+            // find the lowest neighbor in the residual graph
+            mbglIndex hmin = inf, kmin = 0;
+            for (mbglIndex k=ia[v]; k<ia[v+1]; ++k) {
+                Capacity r;
+                #pragma omp atomic read
+                r = res[k];
+                if (r <= 0) { continue; }
+                mbglIndex h;
+                #pragma omp atomic read
+                h = label[ja[k]];
+                if (h < hmin) { hmin = h; kmin = k; }
+            }
+            if (hmin >= inf) {
+                #pragma omp atomic write
+                label[v] = inf;
+                break;
+            }
+            if (label[v] > hmin) {
+                Capacity r, delta;
+                #pragma omp atomic read
+                r = res[kmin];
+                delta = e < r ? e : r;
+                mbglIndex w = ja[kmin];
+                #pragma omp atomic
+                res[kmin] -= delta;
+                #pragma omp atomic
+                res[rev[kmin]] += delta;
+                #pragma omp atomic
+                excess[v] -= delta;
+                #pragma omp atomic
+                excess[w] += delta;
+                if (w != target && w != other) {
+                    char old;
+                    #pragma omp atomic capture
+                    { old = queued[w]; queued[w] = 1; }
+                    if (!old) { next.push_back(w); }
+                }
+            } else {
+                ++nrelabels;
+                #pragma omp atomic write
+                label[v] = hmin+1;
+                if (hmin+1 >= inf) { break; }
+            }
+        }
+        return nrelabels;
+    }
+
+    /** Push all the excess that can reach the target to the target. */
+    void phase(mbglIndex target, mbglIndex other)
+    {
+        const mbglIndex inf = nverts;
+        std::vector<mbglIndex> active;
+        while (1) {
+            global_relabel(target, other);
+            active.clear();
+            for (mbglIndex v=0; v<nverts; ++v) {
+                queued[v] = 0;
+                if (v != target && v != other && excess[v] > 0 && label[v] < inf) {
+                    queued[v] = 1;
+                    active.push_back(v);
+                }
+            }
+            if (active.empty()) { break; }
+
+            // discharge in rounds until the labels are too stale
+            mbglIndex nrelabels = 0;
+            while (!active.empty() && nrelabels < nverts) {
+                std::vector<mbglIndex> next;
+                ptrdiff_t nactive = (ptrdiff_t)active.size();
+                for (ptrdiff_t i=0; i<nactive; ++i) { queued[active[i]] = 0; }
+                #pragma omp parallel if (nactive > 64)
+                {
+                    std::vector<mbglIndex> local;
+                    #pragma omp for schedule(dynamic, 16) reduction(+:nrelabels)
+                    for (ptrdiff_t i=0; i<nactive; ++i) {
+                        nrelabels += discharge(active[i], target, other, local);
+                    }
+                    #pragma omp critical
+                    next.insert(next.end(), local.begin(), local.end());
+                }
+                active.swap(next);
+            }
+        }
+    }
+
+    mbglIndex nverts;
+    mbglIndex *ja, *ia;
+    Capacity *res;
+    mbglIndex *rev;
+    std::vector<Capacity> excess;
+    std::vector<mbglIndex> label;
+    std::vector<char> queued;
+};
+
+template <typename Capacity>
+Capacity parallel_push_relabel_max_flow_help(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,
+    mbglIndex src, mbglIndex sink,
+    Capacity* cap, Capacity* res,
+    mbglIndex* rev_edge_index)
+{
+    mbglIndex nz = ia[nverts];
+    for (mbglIndex k=0; k<nz; ++k) { res[k] = cap[k]; }
+
+    parallel_push_relabel<Capacity> pr(nverts, ja, ia, res, rev_edge_index);
+
+    // saturate the edges out of the source
+    for (mbglIndex k=ia[src]; k<ia[src+1]; ++k) {
+        Capacity delta = res[k];
+        if (delta <= 0 || ja[k] == src) { continue; }
+        res[k] = 0;
+        res[rev_edge_index[k]] += delta;
+        pr.excess[ja[k]] += delta;
+        pr.excess[src] -= delta;
+    }
+
+    pr.phase(sink, src);
+    Capacity flow = pr.excess[sink];
+    pr.phase(src, sink);
+
+    return (flow);
+}
+
+/**
+ * A parallel push relabel max flow computation.
+ *
+ * The first phase saturates the edges out of the source and pushes the
+ * excess toward the sink with the lock-free parallel push-relabel 
+ * algorithm until no more excess can reach the sink.  The second phase 
+ * returns the remaining excess to the source with the same algorithm, 
+ * so the residual capacities are a maximum flow and not just a preflow.
+ * The flow value is the same as push_relabel_max_flow, but the flow 
+ * itself may be different.
+ *
+ * The arguments are the same as push_relabel_max_flow.
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex
+ * @param ia the row connectivity points into ja
+ * @param src the source vertex for the flow
+ * @param sink the sink vertex for the flow
+ * @param cap the array of capacities for each edge
+ * @param res the array of residual capacities for each edge
+ * @param rev_edge_index an array indicating the index of the reverse edge
+ * for the edge with the current index
+ * @param flow the maximum flow in the graph
+ * @return an error code if possible
+ */
+int parallel_push_relabel_max_flow(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,
+    mbglIndex src, mbglIndex sink,
+    int* cap, int* res,
+    mbglIndex* rev_edge_index,
+    int* flow)
+{
+    if (src >= nverts || sink >= nverts || src == sink) { return (-1); }
+    *flow = parallel_push_relabel_max_flow_help(nverts, ja, ia, src, sink,
+        cap, res, rev_edge_index);
+    return (0);
+}
 
+/**
+ * The parallel push relabel max flow computation with double capacities.
+ *
+ * See parallel_push_relabel_max_flow for the arguments.
+ */
+int parallel_push_relabel_max_flow_double(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,
+    mbglIndex src, mbglIndex sink,
+    double* cap, double* res,
+    mbglIndex* rev_edge_index,
+    double* flow)
+{
+    if (src >= nverts || sink >= nverts || src == sink) { return (-1); }
+    *flow = parallel_push_relabel_max_flow_help(nverts, ja, ia, src, sink,
+        cap, res, rev_edge_index);
     return (0);
 }
 
+/**
+ * The state of a Hochbaum pseudoflow max-flow computation.
+ *
+ * This is the highest label pseudoflow algorithm.  It starts with the 
+ * edges out of the source and into the sink saturated, so each vertex 
+ * may have an excess or a deficit.  The vertices form a forest of trees 
+ * with all the excess or deficit at the roots.  A tree is strong if its root
+ * has a positive excess and weak otherwise.  The algorithm takes a 
+ * strong root with the highest label and looks for a merger edge, a 
+ * residual edge from a vertex of the strong tree with the root's label
+ * to a vertex with one less label.  A merger hangs the strong tree from 
+ * the other tree and pushes the excess along the tree path to the new 
+ * root.  The tree splits at any edge that the push saturates.  If the 
+ * strong tree has no merger edge, the vertices with the root's label 
+ * are relabeled.  The labels only increase and a tree above an empty 
+ * label can never merge, so it is lifted to nverts (the gap heuristic).
+ * When no strong root has a label below nverts, the strong vertices are 
+ * the source side of a minimum cut.
+ */
+template <typename Capacity>
+struct pseudoflow_max_flow_state
+{
+    pseudoflow_max_flow_state(mbglIndex nverts_, mbglIndex *ja_, 
+        mbglIndex *ia_, Capacity *res_, mbglIndex *rev_)
+        : nverts(nverts_), ja(ja_), ia(ia_), res(res_), rev(rev_),
+          excess(nverts_,0), label(nverts_,0), parent(nverts_,nverts_),
+          parent_edge(nverts_,0), child(nverts_,nverts_), 
+          next_sibling(nverts_,nverts_), prev_sibling(nverts_,nverts_),
+          next_scan(nverts_,nverts_), current(ia_,ia_+nverts_),
+          label_count(nverts_+1,0), strong_roots(nverts_+1), highest(0)
+    {}
+
+    void add_child(mbglIndex p, mbglIndex c)
+    {
+        const mbglIndex none = nverts;
+        parent[c] = p;
+        prev_sibling[c] = none;
+        next_sibling[c] = child[p];
+        if (child[p] != none) { prev_sibling[child[p]] = c; }
+        child[p] = c;
+    }
+
+    void remove_child(mbglIndex p, mbglIndex c)
+    {
+        const mbglIndex none = nverts;
+        if (prev_sibling[c] != none) { 
+            next_sibling[prev_sibling[c]] = next_sibling[c]; 
+        } else {
+            child[p] = next_sibling[c];
+        }
+        if (next_sibling[c] != none) { 
+            prev_sibling[next_sibling[c]] = prev_sibling[c]; 
+        }
+        parent[c] = none;
+    }
+
+    void add_strong_root(mbglIndex r)
+    {
+        if (label[r] >= nverts) { return; }
+        strong_roots[label[r]].push_back(r);
+        if (label[r] > highest) { highest = label[r]; }
+    }
+
+    bool is_strong_root(mbglIndex r, mbglIndex l)
+    { return (parent[r] == nverts && excess[r] > 0 && label[r] == l); }
+
+    /** Find a merger edge from v to a vertex with label l-1.
+     * @return true if current[v] is a merger edge
+     */
+    bool find_merger(mbglIndex v, mbglIndex l)
+    {
+        for (mbglIndex k=current[v]; k<ia[v+1]; ++k) {
+            if (res[k] > 0 && label[ja[k]]+1 == l) {
+                current[v] = k;
+                return (true);
+            }
+        }
+        current[v] = ia[v+1];
+        return (false);
+    }
+
+    /** Relabel v unless a child has the same label.  The scan continues
+     * from next_scan[v] and stops at a child with the same label. 
+     */
+    void check_children(mbglIndex v)
+    {
+        const mbglIndex none = nverts;
+        for (; next_scan[v] != none; next_scan[v] = next_sibling[next_scan[v]])
+        {
+            if (label[next_scan[v]] == label[v]) { return; }
+        }
+        --label_count[label[v]];
+        ++label[v];
+        ++label_count[label[v]];
+        current[v] = ia[v];
+    }
+
+    /** Hang the tree with vertex v from the merger edge k out of v. */
+    void merge(mbglIndex v, mbglIndex k)
+    {
+        const mbglIndex none = nverts;
+        mbglIndex p = ja[k], e = k;
+        while (v != none) {
+            mbglIndex vp = parent[v], ve = parent_edge[v];
+            if (vp != none) { remove_child(vp, v); }
+            add_child(p, v);
+            parent_edge[v] = e;
+            p = v; 
+            if (vp != none) { e = rev[ve]; }
+            v = vp;
+        }
+    }
+
+    /** Push the excess of r toward the root of its tree and split the 
+     * tree at the saturated edges. */
+    void push_excess(mbglIndex r)
+    {
+        const mbglIndex none = nverts;
+        mbglIndex v = r;
+        Capacity prev = 0;
+        while (excess[v] > 0 && parent[v] != none) {
+            mbglIndex p = parent[v], k = parent_edge[v];
+            Capacity delta = excess[v];
+            prev = excess[p];
+            if (res[k] < delta) { delta = res[k]; }
+            res[k] -= delta;
+            res[rev[k]] += delta;
+            excess[v] -= delta;
+            excess[p] += delta;
+            if (excess[v] > 0) {
+                remove_child(p, v);
+                add_strong_root(v);
+            }
+            v = p;
+        }
+        if (parent[v] == none && excess[v] > 0 && prev <= 0) { 
+            add_strong_root(v); 
+        }
+    }
+
+    /** Look for a merger in the strong tree at r or relabel it. */
+    void process_root(mbglIndex r)
+    {
+        const mbglIndex none = nverts;
+        mbglIndex l = label[r], v = r;
+        next_scan[r] = child[r];
+        if (find_merger(r, l)) { 
+            merge(r, current[r]); 
+            push_excess(r); 
+            return; 
+        }
+        check_children(r);
+        while (v != none) {
+            while (next_scan[v] != none) {
+                mbglIndex c = next_scan[v];
+                next_scan[v] = next_sibling[c];
+                v = c;
+                next_scan[v] = child[v];
+                if (find_merger(v, l)) {
+                    merge(v, current[v]);
+                    push_excess(r);
+                    return;
+                }
+                check_children(v);
+            }
+            v = parent[v];
+            if (v != none) { check_children(v); }
+        }
+        add_strong_root(r);
+    }
+
+    /** Set the label of every vertex in the tree at r to nverts. */
+    void lift_all(mbglIndex r)
+    {
+        const mbglIndex none = nverts;
+        std::vector<mbglIndex> stack(1,r);
+        while (!stack.empty()) {
+            mbglIndex v = stack.back();
+            stack.pop_back();
+            --label_count[label[v]];
+            label[v] = nverts;
+            ++label_count[nverts];
+            for (mbglIndex c=child[v]; c != none; c=next_sibling[c]) {
+                stack.push_back(c);
+            }
+        }
+    }
+
+    /** @return the strong root with the highest label or nverts */
+    mbglIndex next_strong_root()
+    {
+        while (1) {
+            for (; highest > 0; --highest) {
+                std::vector<mbglIndex>& roots = strong_roots[highest];
+                while (!roots.empty()) {
+                    mbglIndex r = roots.back();
+                    roots.pop_back();
+                    if (!is_strong_root(r, highest)) { continue; }
+                    if (label_count[highest-1] > 0) { return (r); }
+                    lift_all(r);
+                }
+            }
+            // the new strong roots with label 0 start at label 1
+            std::vector<mbglIndex>& roots = strong_roots[0];
+            if (roots.empty()) { return (nverts); }
+            while (!roots.empty()) {
+                mbglIndex r = roots.back();
+                roots.pop_back();
+                if (!is_strong_root(r, 0)) { continue; }
+                --label_count[0];
+                label[r] = 1;
+                ++label_count[1];
+                strong_roots[1].push_back(r);
+            }
+            highest = 1;
+        }
+    }
+
+    /** Label each vertex with its distance to a deficit in the residual 
+     * graph, or nverts if it cannot reach a deficit.  Any labels that are
+     * lower bounds on this distance are valid, and the exact distances 
+     * save the relabels that would find them one step at a time.
+     */
+    void initial_labels(mbglIndex src, mbglIndex sink)
+    {
+        std::vector<mbglIndex> queue;
+        for (mbglIndex v=0; v<nverts; ++v) {
+            label[v] = nverts;
+            if (v != src && v != sink && excess[v] < 0) { 
+                label[v] = 0;
+                queue.push_back(v);
+            }
+        }
+        for (size_t i=0; i<queue.size(); ++i) {
+            mbglIndex w = queue[i];
+            for (mbglIndex k=ia[w]; k<ia[w+1]; ++k) {
+                mbglIndex u = ja[k];
+                if (label[u] != nverts || u == src || u == sink) { continue; }
+                if (res[rev[k]] > 0) {
+                    label[u] = label[w]+1;
+                    queue.push_back(u);
+                }
+            }
+        }
+    }
+
+    /** Find the minimum cut from the terminals.
+     * @return the pseudoflow into the sink
+     */
+    Capacity phase1(mbglIndex src, mbglIndex sink)
+    {
+        for (mbglIndex k=ia[src]; k<ia[src+1]; ++k) {
+            Capacity delta = res[k];
+            if (delta <= 0 || ja[k] == src) { continue; }
+            res[k] = 0;
+            res[rev[k]] += delta;
+            excess[ja[k]] += delta;
+        }
+        for (mbglIndex k=ia[sink]; k<ia[sink+1]; ++k) {
+            mbglIndex v = ja[k];
+            Capacity delta = res[rev[k]];
+            if (delta <= 0 || v == sink || v == src) { continue; }
+            res[rev[k]] = 0;
+            res[k] += delta;
+            excess[v] -= delta;
+            excess[sink] += delta;
+        }
+        initial_labels(src, sink);
+        for (mbglIndex v=0; v<nverts; ++v) {
+            if (v == src || v == sink) { continue; }
+            ++label_count[label[v]];
+            if (excess[v] > 0) { add_strong_root(v); }
+        }
+
+        mbglIndex r;
+        while ((r = next_strong_root()) != nverts) { process_root(r); }
+        return (excess[sink]);
+    }
+
+    mbglIndex nverts;
+    mbglIndex *ja, *ia;
+    Capacity *res;
+    mbglIndex *rev;
+    std::vector<Capacity> excess;
+    std::vector<mbglIndex> label, parent, parent_edge;
+    std::vector<mbglIndex> child, next_sibling, prev_sibling, next_scan;
+    std::vector<mbglIndex> current, label_count;
+    std::vector< std::vector<mbglIndex> > strong_roots;
+    mbglIndex highest;
+};
+
+/** Augment a flow to a maximum flow with the pseudoflow algorithm
+ * starting from the flow in the residual capacities res instead of a
+ * zero flow.  Any feasible flow works, such as a maximum flow for smaller
+ * capacities.  The return value is only the additional flow into the
+ * sink, so it is the maximum flow value when res starts as the
+ * capacities.
+ */
+template <typename Capacity>
+Capacity pseudoflow_max_flow_warm(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,
+    mbglIndex src, mbglIndex sink, Capacity* res,
+    mbglIndex* rev_edge_index)
+{
+    pseudoflow_max_flow_state<Capacity> pf(nverts, ja, ia, res, 
+        rev_edge_index);
+    pf.phase1(src, sink);
+
+    // the deficits go back to the sink along the edges from the sink,
+    // then the excess goes back to the source with a push relabel phase
+    parallel_push_relabel<Capacity> pr(nverts, ja, ia, res, rev_edge_index);
+    for (mbglIndex k=ia[sink]; k<ia[sink+1]; ++k) {
+        mbglIndex v = ja[k];
+        if (v == src || v == sink || pf.excess[v] >= 0) { continue; }
+        Capacity delta = -pf.excess[v];
+        if (res[k] < delta) { delta = res[k]; }
+        res[k] -= delta;
+        res[rev_edge_index[k]] += delta;
+        pf.excess[v] += delta;
+        pf.excess[sink] -= delta;
+    }
+    for (mbglIndex v=0; v<nverts; ++v) { pr.excess[v] = pf.excess[v]; }
+    pr.phase(src, sink);
+
+    // the excess of the sink is a sum of pushes and returns, which can
+    // round to a tiny negative number with double capacities
+    if (pf.excess[sink] < 0) { return (0); }
+    return (pf.excess[sink]);
+}
+
+template <typename Capacity>
+Capacity pseudoflow_max_flow_help(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,
+    mbglIndex src, mbglIndex sink,
+    Capacity* cap, Capacity* res,
+    mbglIndex* rev_edge_index)
+{
+    mbglIndex nz = ia[nverts];
+    for (mbglIndex k=0; k<nz; ++k) { res[k] = cap[k]; }
+    return (pseudoflow_max_flow_warm(nverts, ja, ia, src, sink, res, 
+        rev_edge_index));
+}
 
+/**
+ * A Hochbaum pseudoflow max flow computation.
+ *
+ * The first phase is the highest label pseudoflow algorithm, which finds
+ * a minimum cut without keeping a feasible flow.  The second phase sends
+ * the deficits back to the sink and the excess back to the source with
+ * a push relabel phase, so the residual capacities are a maximum flow.
+ *
+ * The arguments are the same as push_relabel_max_flow.
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex
+ * @param ia the row connectivity points into ja
+ * @param src the source vertex for the flow
+ * @param sink the sink vertex for the flow
+ * @param cap the array of capacities for each edge
+ * @param res the array of residual capacities for each edge
+ * @param rev_edge_index an array indicating the index of the reverse edge
+ * for the edge with the current index
+ * @param flow the maximum flow in the graph
+ * @return an error code if possible
+ */
+int pseudoflow_max_flow(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,
+    mbglIndex src, mbglIndex sink,
+    int* cap, int* res,
+    mbglIndex* rev_edge_index,
+    int* flow)
+{
+    if (src >= nverts || sink >= nverts || src == sink) { return (-1); }
+    *flow = pseudoflow_max_flow_help(nverts, ja, ia, src, sink,
+        cap, res, rev_edge_index);
+    return (0);
+}
 
+/**
+ * The pseudoflow max flow computation with double capacities.
+ *
+ * See pseudoflow_max_flow for the arguments.
+ */
+int pseudoflow_max_flow_double(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,
+    mbglIndex src, mbglIndex sink,
+    double* cap, double* res,
+    mbglIndex* rev_edge_index,
+    double* flow)
+{
+    if (src >= nverts || sink >= nverts || src == sink) { return (-1); }
+    *flow = pseudoflow_max_flow_help(nverts, ja, ia, src, sink,
+        cap, res, rev_edge_index);
+    return (0);
+}
+
+/**
+ * A flow network with a residual structure that is built once and reused
+ * for many max-flow problems with different capacities and terminals.
+ *
+ * The network has the nverts vertices of the graph and two extra 
+ * vertices, a super source s = nverts and a super sink t = nverts+1.  
+ * Each edge (i,j) of the graph is an edge in row i with a reverse edge 
+ * in row j.  Each vertex v has an edge (s,v) and an edge (v,t) with 
+ * their reverse edges.  The terminals of a problem are given by the 
+ * capacities on the edges to s and t.
+ */
+struct flow_network
+{
+    mbglIndex nverts;
+    mbglIndex nedges;
+    std::vector<mbglIndex> ia, ja, rev;
+    /** the index of edge k of the graph in the network */
+    std::vector<mbglIndex> edge;
+    /** the index of the edges (s,v) and (v,t) in the network */
+    std::vector<mbglIndex> source_edge, sink_edge;
+    std::vector<int> cap, res;
+    /** the capacities for flow_network_max_flow_double */
+    std::vector<double> dcap, dres;
+    std::vector<mbglIndex> queue;
+};
+
+/**
+ * Build the residual structure of a flow network for a graph.
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex
+ * @param ia the row connectivity points into ja
+ * @param net the new flow network, free it with free_flow_network
+ * @return an error code if possible
+ */
+int create_flow_network(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,
+    flow_network **net)
+{
+    mbglIndex nz = ia[nverts];
+    mbglIndex n = nverts+2, s = nverts, t = nverts+1;
+    flow_network *f = new flow_network;
+    f->nverts = nverts;
+    f->nedges = nz;
+
+    // count the degree of each vertex in the network
+    std::vector<mbglIndex>& fia = f->ia;
+    fia.assign(n+1,0);
+    for (mbglIndex i=0; i<nverts; ++i) {
+        for (mbglIndex k=ia[i]; k<ia[i+1]; ++k) {
+            fia[i+1]++;
+            fia[ja[k]+1]++;
+        }
+        fia[i+1] += 2;
+    }
+    fia[s+1] = nverts;
+    fia[t+1] = nverts;
+    for (mbglIndex i=0; i<n; ++i) { fia[i+1] += fia[i]; }
+
+    mbglIndex nfz = fia[n];
+    f->ja.resize(nfz);
+    f->rev.resize(nfz);
+    f->cap.assign(nfz,0);
+    f->res.assign(nfz,0);
+    f->edge.resize(nz);
+    f->source_edge.resize(nverts);
+    f->sink_edge.resize(nverts);
+    f->queue.resize(n);
+
+    // fill in the edges with a running position for each row
+    std::vector<mbglIndex> pos(fia.begin(), fia.end()-1);
+    for (mbglIndex i=0; i<nverts; ++i) {
+        for (mbglIndex k=ia[i]; k<ia[i+1]; ++k) {
+            mbglIndex j = ja[k];
+            mbglIndex e = pos[i]++, re = pos[j]++;
+            f->ja[e] = j; f->ja[re] = i;
+            f->rev[e] = re; f->rev[re] = e;
+            f->edge[k] = e;
+        }
+    }
+    for (mbglIndex v=0; v<nverts; ++v) {
+        mbglIndex e = pos[s]++, re = pos[v]++;
+        f->ja[e] = v; f->ja[re] = s;
+        f->rev[e] = re; f->rev[re] = e;
+        f->source_edge[v] = e;
+        e = pos[v]++; re = pos[t]++;
+        f->ja[e] = t; f->ja[re] = v;
+        f->rev[e] = re; f->rev[re] = e;
+        f->sink_edge[v] = e;
+    }
+
+    *net = f;
+    return (0);
+}
+
+/**
+ * Free a flow network from create_flow_network.
+ */
+int free_flow_network(flow_network *net)
+{
+    delete net;
+    return (0);
+}
+
+/** Run an int max-flow algorithm for flow_network_max_flow. */
+static int flow_network_algorithm(int algorithm, 
+    mbglIndex n, mbglIndex *ja, mbglIndex *ia, mbglIndex s, mbglIndex t,
+    int *cap, int *res, mbglIndex *rev, int *flow)
+{
+    switch (algorithm) {
+        case 1: return push_relabel_max_flow(n,ja,ia,s,t,cap,res,rev,flow);
+        case 2: return edmunds_karp_max_flow(n,ja,ia,s,t,cap,res,rev,flow);
+        case 3: return kolmogorov_max_flow(n,ja,ia,s,t,cap,res,rev,flow);
+        case 4: 
+            return parallel_push_relabel_max_flow(n,ja,ia,s,t,cap,res,rev,flow);
+        case 5: return dinic_max_flow(n,ja,ia,s,t,cap,res,rev,flow);
+        case 6: return pseudoflow_max_flow(n,ja,ia,s,t,cap,res,rev,flow);
+    }
+    return (-1);
+}
+
+/** Run a double max-flow algorithm for flow_network_max_flow_double. */
+static int flow_network_algorithm(int algorithm, 
+    mbglIndex n, mbglIndex *ja, mbglIndex *ia, mbglIndex s, mbglIndex t,
+    double *cap, double *res, mbglIndex *rev, double *flow)
+{
+    switch (algorithm) {
+        case 1: case 4:
+            return parallel_push_relabel_max_flow_double(
+                n,ja,ia,s,t,cap,res,rev,flow);
+        case 3: 
+            return kolmogorov_max_flow_double(n,ja,ia,s,t,cap,res,rev,flow);
+        case 5: return dinic_max_flow_double(n,ja,ia,s,t,cap,res,rev,flow);
+        case 6: 
+            return pseudoflow_max_flow_double(n,ja,ia,s,t,cap,res,rev,flow);
+    }
+    return (-1);
+}
+
+/** Round a capacity down for an integer flow. */
+inline double flow_network_capacity(double c, int)
+{ return (floor(c)); }
+
+/** Keep a capacity for a double flow. */
+inline double flow_network_capacity(double c, double)
+{ return (c); }
+
+template <typename Capacity>
+int flow_network_max_flow_help(
+    flow_network *net, double *cap, 
+    mbglIndex nsources, mbglIndex *sources, double *source_cap,
+    mbglIndex nsinks, mbglIndex *sinks, double *sink_cap,
+    int algorithm, Capacity *flow, int *mincut, double *res,
+    std::vector<Capacity>& fcap, std::vector<Capacity>& fres)
+{
+    mbglIndex nverts = net->nverts;
+    mbglIndex n = nverts+2, s = nverts, t = nverts+1;
+    const double cmax = (double)std::numeric_limits<Capacity>::max();
+    const Capacity type_tag = 0;
+
+    for (mbglIndex i=0; i<nsources; ++i) {
+        if (sources[i] >= nverts) { return (-1); }
+    }
+    for (mbglIndex i=0; i<nsinks; ++i) {
+        if (sinks[i] >= nverts) { return (-1); }
+    }
+
+    // set the finite capacities and track the in and out capacity of 
+    // each vertex to make an infinite capacity for the terminals, every
+    // capacity is checked before the cast so it cannot overflow
+    fcap.assign(net->ja.size(), 0);
+    std::vector<double> incap(nverts,0.0), outcap(nverts,0.0);
+    std::vector<double> scap(nverts,0.0);
+    for (mbglIndex k=0; k<net->nedges; ++k) {
+        mbglIndex e = net->edge[k];
+        mbglIndex i = net->ja[net->rev[e]], j = net->ja[e];
+        double c = flow_network_capacity(cap[k], type_tag);
+        if (c < 0) { c = 0; }
+        if (c > cmax) { return (-2); }
+        fcap[e] = (Capacity)c;
+        outcap[i] += c;
+        incap[j] += c;
+    }
+    for (mbglIndex v=0; v<nverts; ++v) {
+        if (source_cap && source_cap[v] > 0) {
+            double c = flow_network_capacity(source_cap[v], type_tag);
+            if (c > cmax) { return (-2); }
+            fcap[net->source_edge[v]] = (Capacity)c;
+            scap[v] = c;
+            incap[v] += c;
+        }
+        if (sink_cap && sink_cap[v] > 0) {
+            double c = flow_network_capacity(sink_cap[v], type_tag);
+            if (c > cmax) { return (-2); }
+            fcap[net->sink_edge[v]] = (Capacity)c;
+            outcap[v] += c;
+        }
+    }
+    // the flow out of a source never exceeds its out capacity, so one
+    // more is an infinite capacity, and likewise for a sink
+    std::vector<char> terminal(nverts,0);
+    for (mbglIndex i=0; i<nsources; ++i) { terminal[sources[i]] = 1; }
+    for (mbglIndex i=0; i<nsinks; ++i) {
+        mbglIndex v = sinks[i];
+        if (terminal[v] == 1) { return (-1); }
+        terminal[v] = 2;
+    }
+    double total = 0.0;
+    for (mbglIndex v=0; v<nverts; ++v) {
+        double c;
+        if (terminal[v] == 1) {
+            c = outcap[v] + 1.0;
+            if (c > cmax) { return (-2); }
+            fcap[net->source_edge[v]] = (Capacity)c;
+            scap[v] = c;
+        } else if (terminal[v] == 2) {
+            c = incap[v] + 1.0;
+            if (c > cmax) { return (-2); }
+            fcap[net->sink_edge[v]] = (Capacity)c;
+        }
+        total += scap[v];
+    }
+    if (total > cmax) { return (-2); }
+
+    fres.assign(net->ja.size(), 0);
+    mbglIndex *fja = &net->ja[0], *fia = &net->ia[0], *frev = &net->rev[0];
+    Capacity f = 0;
+    if (flow_network_algorithm(algorithm, n, fja, fia, s, t, 
+            &fcap[0], &fres[0], frev, &f) != 0) {
+        return (-1);
+    }
+    if (flow) { *flow = f; }
+
+    if (mincut) {
+        // search the unsaturated edges from the super source
+        std::vector<char> visited(n,0);
+        mbglIndex *q = &net->queue[0], qhead = 0, qtail = 0;
+        visited[s] = 1;
+        q[qtail++] = s;
+        while (qhead != qtail) {
+            mbglIndex u = q[qhead++];
+            for (mbglIndex k=fia[u]; k<fia[u+1]; ++k) {
+                mbglIndex v = fja[k];
+                if (fres[k] > 0 && !visited[v]) {
+                    visited[v] = 1;
+                    q[qtail++] = v;
+                }
+            }
+        }
+        for (mbglIndex v=0; v<nverts; ++v) { mincut[v] = visited[v] ? 1 : -1; }
+    }
+
+    if (res) {
+        for (mbglIndex k=0; k<net->nedges; ++k) { 
+            res[k] = (double)fres[net->edge[k]]; 
+        }
+    }
+
+    return (0);
+}
+
+/**
+ * Compute a maximum flow and minimum cut in a flow network.
+ *
+ * The vertices in sources are connected to the super source and the 
+ * vertices in sinks to the super sink with edges that are never in a 
+ * minimum cut.  The other terminal edges have the capacities in 
+ * source_cap and sink_cap.  All the capacities are rounded down to 
+ * integers.
+ *
+ * @param net the flow network
+ * @param cap the capacity of each edge of the graph
+ * @param nsources the number of source vertices
+ * @param sources the source vertices
+ * @param source_cap the capacity from the super source to each vertex 
+ *   (optional)
+ * @param nsinks the number of sink vertices
+ * @param sinks the sink vertices
+ * @param sink_cap the capacity from each vertex to the super sink 
+ *   (optional)
+ * @param algorithm the max-flow algorithm
+ *   1: push_relabel_max_flow
+ *   2: edmunds_karp_max_flow
+ *   3: kolmogorov_max_flow
+ *   4: parallel_push_relabel_max_flow
+ *   5: dinic_max_flow
+ *   6: pseudoflow_max_flow
+ * @param flow the maximum flow 
+ * @param mincut the minimum cut, mincut[v] = 1 if v is on the source side
+ *   and mincut[v] = -1 otherwise (optional)
+ * @param res the residual capacity of each edge of the graph (optional)
+ * @return an error code if possible
+ *   0: indicates success
+ *  -1: indicates a parameter error with a terminal or the algorithm
+ *  -2: indicates the capacities overflow an int
+ */
+int flow_network_max_flow(
+    flow_network *net, double *cap, 
+    mbglIndex nsources, mbglIndex *sources, double *source_cap,
+    mbglIndex nsinks, mbglIndex *sinks, double *sink_cap,
+    int algorithm, int *flow, int *mincut, double *res)
+{
+    return flow_network_max_flow_help(net, cap, nsources, sources, 
+        source_cap, nsinks, sinks, sink_cap, algorithm, flow, mincut, res,
+        net->cap, net->res);
+}
+
+/**
+ * Compute a maximum flow and minimum cut in a flow network with double
+ * capacities.
+ *
+ * The arguments are the same as flow_network_max_flow except that the
+ * capacities are not rounded and the flow is a double.  The boost 
+ * push_relabel (1) code checks the conservation of flow exactly, which
+ * fails with rounding, so it uses parallel_push_relabel (4) instead.  The
+ * edmunds_karp (2) algorithm does not support double capacities.
+ */
+int flow_network_max_flow_double(
+    flow_network *net, double *cap, 
+    mbglIndex nsources, mbglIndex *sources, double *source_cap,
+    mbglIndex nsinks, mbglIndex *sinks, double *sink_cap,
+    int algorithm, double *flow, int *mincut, double *res)
+{
+    return flow_network_max_flow_help(net, cap, nsources, sources, 
+        source_cap, nsinks, sinks, sink_cap, algorithm, flow, mincut, res,
+        net->dcap, net->dres);
+}
+
+/**
+ * A parametric max flow computation on a flow network.
+ *
+ * The computation keeps the preflow of the push relabel algorithm 
+ * between problems where the capacities of the edges from the super 
+ * source do not decrease and the capacities of the edges to the super 
+ * sink do not increase (Gallo, Grigoriadis, and Tarjan).  Then each new
+ * problem only pushes the new excess.  The labels are not kept, because
+ * each phase starts with a global relabel, which costs one breadth first
+ * search per problem.
+ */
+struct parametric_max_flow
+{
+    parametric_max_flow(flow_network *net_)
+        : net(net_), cap(net_->ja.size(), 0.0), res(net_->ja.size(), 0.0),
+          pr(net_->nverts+2, &net_->ja[0], &net_->ia[0], &res[0], 
+            &net_->rev[0]),
+          initialized(false)
+    {}
+
+    flow_network *net;
+    std::vector<double> cap, res;
+    parallel_push_relabel<double> pr;
+    bool initialized;
+};
+
+/**
+ * Start a parametric max flow computation on a flow network.
+ *
+ * The capacities of the edges of the graph are fixed for the whole 
+ * computation.  The capacities of the terminal edges are given with
+ * parametric_max_flow_update.
+ *
+ * @param net the flow network, which must not be freed before the 
+ *   parametric computation
+ * @param cap the capacity of each edge of the graph
+ * @param pf the new parametric computation, free it with 
+ *   free_parametric_max_flow
+ * @return an error code if possible
+ */
+int create_parametric_max_flow(
+    flow_network *net, double *cap, parametric_max_flow **pf)
+{
+    if (net->nverts == 0) { return (-1); }
+    parametric_max_flow *p = new parametric_max_flow(net);
+    for (mbglIndex k=0; k<net->nedges; ++k) {
+        mbglIndex e = net->edge[k];
+        p->cap[e] = cap[k] > 0 ? cap[k] : 0.0;
+        p->res[e] = p->cap[e];
+    }
+    *pf = p;
+    return (0);
+}
+
+/**
+ * Free a parametric max flow computation.
+ */
+int free_parametric_max_flow(parametric_max_flow *pf)
+{
+    delete pf;
+    return (0);
+}
+
+/**
+ * Solve the next max flow problem of a parametric computation.
+ *
+ * After the first problem, the capacities from the super source cannot 
+ * decrease and the capacities to the super sink cannot increase.  The 
+ * minimum cut has the largest source side, so the source sides of the 
+ * sequence of problems are nested.
+ *
+ * @param pf the parametric computation
+ * @param source_cap the capacity from the super source to each vertex
+ * @param sink_cap the capacity from each vertex to the super sink
+ * @param flow the maximum flow
+ * @param mincut the minimum cut, mincut[v] = 1 if v is on the source side
+ *   and mincut[v] = -1 otherwise (optional)
+ * @return an error code if possible
+ *   0: indicates success
+ *  -1: indicates a capacity is negative, a source capacity decreased, or
+ *      a sink capacity increased
+ */
+int parametric_max_flow_update(
+    parametric_max_flow *pf, double *source_cap, double *sink_cap,
+    double *flow, int *mincut)
+{
+    flow_network *net = pf->net;
+    mbglIndex nverts = net->nverts;
+    mbglIndex s = nverts, t = nverts+1;
+    std::vector<double>& cap = pf->cap;
+    std::vector<double>& res = pf->res;
+    std::vector<double>& excess = pf->pr.excess;
+    mbglIndex *rev = &net->rev[0];
+
+    for (mbglIndex v=0; v<nverts; ++v) {
+        if (source_cap[v] < 0 || sink_cap[v] < 0) { return (-1); }
+        if (pf->initialized && 
+            (source_cap[v] < cap[net->source_edge[v]] ||
+             sink_cap[v] > cap[net->sink_edge[v]])) { return (-1); }
+    }
+    pf->initialized = true;
+
+    for (mbglIndex v=0; v<nverts; ++v) {
+        // the edges from the source stay saturated, so push the increase
+        mbglIndex e = net->source_edge[v];
+        double delta = source_cap[v] - cap[e];
+        cap[e] = source_cap[v];
+        res[rev[e]] += delta;
+        excess[v] += delta;
+        excess[s] -= delta;
+        // return any flow over the new capacity to the vertex
+        e = net->sink_edge[v];
+        double f = cap[e] - res[e];
+        cap[e] = sink_cap[v];
+        if (f > cap[e]) {
+            excess[v] += f - cap[e];
+            excess[t] -= f - cap[e];
+            res[e] = 0;
+            res[rev[e]] = cap[e];
+        } else {
+            res[e] = cap[e] - f;
+        }
+    }
+
+    pf->pr.phase(t, s);
+    *flow = excess[t];
+
+    if (mincut) {
+        // the sink side are the vertices that reach the sink
+        mbglIndex *ja = &net->ja[0], *ia = &net->ia[0];
+        mbglIndex *q = &net->queue[0], qhead = 0, qtail = 0;
+        std::vector<char> visited(nverts+2,0);
+        visited[t] = 1;
+        q[qtail++] = t;
+        while (qhead != qtail) {
+            mbglIndex u = q[qhead++];
+            for (mbglIndex k=ia[u]; k<ia[u+1]; ++k) {
+                mbglIndex v = ja[k];
+                if (res[rev[k]] > 0 && !visited[v]) {
+                    visited[v] = 1;
+                    q[qtail++] = v;
+                }
+            }
+        }
+        for (mbglIndex v=0; v<nverts; ++v) { mincut[v] = visited[v] ? -1 : 1; }
+    }
+
+    return (0);
+}
+
+/** Compute a maximum flow between any two vertices s and t of a flow 
+ * network and the source side of the minimum cut.
+ *
+ * @param side side[v] = 1 if v is on the side of s and 0 otherwise
+ */
+static int flow_network_cut(flow_network *net, int algorithm, 
+    double *cap, mbglIndex s, mbglIndex t, 
+    double *res, mbglIndex *queue, char *side, double *flow)
+{
+    mbglIndex n = net->nverts+2;
+    mbglIndex *fja = &net->ja[0], *fia = &net->ia[0], *frev = &net->rev[0];
+    if (flow_network_algorithm(algorithm, n, fja, fia, s, t, 
+            cap, res, frev, flow) != 0) {
+        return (-1);
+    }
+    std::fill(side, side+n, 0);
+    mbglIndex qhead = 0, qtail = 0;
+    side[s] = 1;
+    queue[qtail++] = s;
+    while (qhead != qtail) {
+        mbglIndex u = queue[qhead++];
+        for (mbglIndex k=fia[u]; k<fia[u+1]; ++k) {
+            mbglIndex v = fja[k];
+            if (res[k] > 0 && !side[v]) {
+                side[v] = 1;
+                queue[qtail++] = v;
+            }
+        }
+    }
+    return (0);
+}
+
+/**
+ * Compute a Gomory-Hu cut tree of an undirected graph with Gusfield's 
+ * algorithm.
+ *
+ * The minimum cut between any two vertices is the smallest value on the
+ * path between them in the tree, and removing that tree edge splits the
+ * vertices into the two sides of a minimum cut.  Gusfield's algorithm 
+ * solves nverts-1 max flow problems on the original graph.  All the 
+ * problems use one flow network.  The problem for vertex s is between s 
+ * and its current parent, so the problems for the next few vertices are 
+ * solved in parallel with the current parents, and a result is only used
+ * if an earlier problem in the batch did not change the parent.
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex
+ * @param ia the row connectivity points into ja
+ * @param weight the weight of each edge, the graph must be symmetric
+ * @param algorithm the max-flow algorithm, see flow_network_max_flow_double
+ * @param i the tree edges are (i[k],j[k]) for k=0..nverts-2
+ * @param j the tree edges are (i[k],j[k]) for k=0..nverts-2
+ * @param val the minimum cut value for tree edge k
+ * @return an error code if possible
+ */
+int gomory_hu_tree(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, double *weight,
+    int algorithm, mbglIndex *i, mbglIndex *j, double *val)
+{
+    if (nverts == 0) { return (0); }
+
+    flow_network *net;
+    create_flow_network(nverts, ja, ia, &net);
+    mbglIndex n = nverts+2, nfz = (mbglIndex)net->ja.size();
+    std::vector<double> cap(nfz, 0.0);
+    for (mbglIndex k=0; k<net->nedges; ++k) {
+        cap[net->edge[k]] = weight[k] > 0 ? weight[k] : 0.0;
+    }
+
+    std::vector<mbglIndex> p(nverts, 0);
+    std::vector<double> fl(nverts, 0.0);
+
+    ptrdiff_t nbatch = 1;
+#ifdef _OPENMP
+    nbatch = (ptrdiff_t)omp_get_max_threads();
+#endif /* _OPENMP */
+    std::vector< std::vector<double> > res(nbatch, std::vector<double>(nfz));
+    std::vector< std::vector<mbglIndex> > queue(nbatch, 
+        std::vector<mbglIndex>(n));
+    std::vector< std::vector<char> > side(nbatch, std::vector<char>(n));
+    std::vector<mbglIndex> target(nbatch);
+    std::vector<double> flow(nbatch);
+    std::vector<int> rval(nbatch);
+
+    mbglIndex s = 1;
+    while (s < nverts) {
+        ptrdiff_t nb = nbatch;
+        if ((ptrdiff_t)(nverts-s) < nb) { nb = (ptrdiff_t)(nverts-s); }
+        for (ptrdiff_t b=0; b<nb; ++b) { target[b] = p[s+b]; }
+
+        #pragma omp parallel for schedule(dynamic, 1) if (nb > 1)
+        for (ptrdiff_t b=0; b<nb; ++b) {
+            rval[b] = flow_network_cut(net, algorithm, &cap[0], 
+                s+(mbglIndex)b, target[b], &res[b][0], &queue[b][0], 
+                &side[b][0], &flow[b]);
+        }
+
+        // apply the cuts in order until one has a stale parent
+        ptrdiff_t b = 0;
+        for (; b<nb; ++b) {
+            mbglIndex v = s+(mbglIndex)b, t = target[b];
+            if (rval[b] != 0) { 
+                free_flow_network(net);
+                return (-1);
+            }
+            if (p[v] != t) { break; }
+            char *x = &side[b][0];
+            fl[v] = flow[b];
+            for (mbglIndex u=0; u<nverts; ++u) {
+                if (u != v && x[u] && p[u] == t) { p[u] = v; }
+            }
+            if (x[p[t]]) {
+                p[v] = p[t];
+                p[t] = v;
+                fl[v] = fl[t];
+                fl[t] = flow[b];
+            }
+        }
+        s += (mbglIndex)b;
+    }
+    free_flow_network(net);
+
+    for (mbglIndex v=1; v<nverts; ++v) {
+        i[v-1] = v;
+        j[v-1] = p[v];
+        val[v-1] = fl[v];
+    }
+    return (0);
+}
+
+/**
+ * Compute a multiway cut of an undirected graph from the isolating cuts 
+ * of the terminals.
+ *
+ * The isolating cut of a terminal is a minimum cut between the terminal
+ * and all the other terminals.  The source sides of the isolating cuts 
+ * are as small as possible, so they are disjoint.  Each terminal takes 
+ * the source side of its isolating cut except the terminal with the 
+ * largest isolating cut, which takes the remaining vertices.  The 
+ * multiway cut is within a factor of 2-2/nterms of the minimum (Dahlhaus 
+ * et al.).  The isolating cuts are solved in parallel with OpenMP; they
+ * share the flow network and each thread has its own capacities and 
+ * residuals.
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex
+ * @param ia the row connectivity points into ja
+ * @param weight the weight of each edge, the graph must be symmetric
+ * @param nterms the number of terminals, at least 2
+ * @param terms the terminal vertices
+ * @param algorithm the max-flow algorithm, see flow_network_max_flow_double
+ * @param labels labels[v] = i if v is on the side of terms[i]
+ * @param cut cut[k] = 1 if edge k is in the multiway cut and 0 otherwise
+ *   (optional)
+ * @param isolating the value of the isolating cut of each terminal 
+ *   (optional)
+ * @param value the total weight of the edges in the cut, counting each 
+ *   undirected edge once
+ * @return an error code if possible
+ *   0: indicates success
+ *  -1: indicates a parameter error with a terminal or the algorithm
+ */
+int multiway_cut(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, double *weight,
+    mbglIndex nterms, mbglIndex *terms, int algorithm,
+    mbglIndex *labels, int *cut, double *isolating, double *value)
+{
+    const mbglIndex none = nterms;
+    if (nterms < 2) { return (-1); }
+    std::vector<mbglIndex> term(nverts, none);
+    for (mbglIndex i=0; i<nterms; ++i) {
+        if (terms[i] >= nverts || term[terms[i]] != none) { return (-1); }
+        term[terms[i]] = i;
+    }
+
+    flow_network *net;
+    create_flow_network(nverts, ja, ia, &net);
+    mbglIndex n = nverts+2, t = nverts+1, nfz = (mbglIndex)net->ja.size();
+    std::vector<double> cap(nfz, 0.0);
+    double total = 1.0;
+    for (mbglIndex k=0; k<net->nedges; ++k) {
+        cap[net->edge[k]] = weight[k] > 0 ? weight[k] : 0.0;
+        total += cap[net->edge[k]];
+    }
+    // the edges from every terminal to the sink have an infinite capacity,
+    // and each problem removes the one from its source
+    for (mbglIndex i=0; i<nterms; ++i) { cap[net->sink_edge[terms[i]]] = total; }
+
+    std::vector<double> flow(nterms);
+    std::vector< std::vector<mbglIndex> > sides(nterms);
+    int rval = 0;
+
+    #pragma omp parallel
+    {
+        std::vector<double> tcap(cap), res(nfz);
+        std::vector<mbglIndex> queue(n);
+        std::vector<char> side(n);
+
+        #pragma omp for schedule(dynamic, 1)
+        for (ptrdiff_t i=0; i<(ptrdiff_t)nterms; ++i) {
+            mbglIndex s = terms[i];
+            tcap[net->sink_edge[s]] = 0.0;
+            if (flow_network_cut(net, algorithm, &tcap[0], s, t, 
+                    &res[0], &queue[0], &side[0], &flow[i]) != 0) {
+                #pragma omp atomic write
+                rval = -1;
+            } else {
+                for (mbglIndex v=0; v<nverts; ++v) {
+                    if (side[v]) { sides[i].push_back(v); }
+                }
+            }
+            tcap[net->sink_edge[s]] = total;
+        }
+    }
+    free_flow_network(net);
+    if (rval != 0) { return (rval); }
+
+    // the terminal with the largest isolating cut takes the rest
+    mbglIndex imax = 0;
+    for (mbglIndex i=0; i<nterms; ++i) {
+        if (flow[i] > flow[imax]) { imax = i; }
+        if (isolating) { isolating[i] = flow[i]; }
+    }
+    for (mbglIndex v=0; v<nverts; ++v) { labels[v] = imax; }
+    for (mbglIndex i=0; i<nterms; ++i) {
+        if (i == imax) { continue; }
+        for (size_t k=0; k<sides[i].size(); ++k) { labels[sides[i][k]] = i; }
+    }
+
+    double cutval = 0.0;
+    for (mbglIndex u=0; u<nverts; ++u) {
+        for (mbglIndex k=ia[u]; k<ia[u+1]; ++k) {
+            int c = labels[u] != labels[ja[k]];
+            if (c && weight[k] > 0) { cutval += weight[k]; }
+            if (cut) { cut[k] = c; }
+        }
+    }
+    *value = cutval/2.0;
+    return (0);
+}
+
+/** Compute the cut and the weight of the set with flow_improve. */
+static void flow_improve_cut(mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,
+    double *weight, double *p, int *set, double *cut, double *vol)
+{
+    double c = 0.0, v = 0.0;
+    for (mbglIndex u=0; u<nverts; ++u) {
+        if (!set[u]) { continue; }
+        v += p[u];
+        for (mbglIndex k=ia[u]; k<ia[u+1]; ++k) {
+            if (!set[ja[k]] && weight[k] > 0) { c += weight[k]; }
+        }
+    }
+    *cut = c;
+    *vol = v;
+}
+
+/**
+ * Improve a set of vertices with Andersen and Lang's FlowImprove or with 
+ * Lang and Rao's MQI.
+ *
+ * Let A be the set, B the other vertices, p(S) the sum of the vertex 
+ * weights in S, and f = p(A)/p(B).  FlowImprove minimizes the quotient
+ *   cut(S)/(p(S & A) - f*p(S & B))
+ * over all sets S where the denominator is positive, and MQI minimizes 
+ * cut(S)/p(S) over the subsets S of A.  Each iteration solves a max flow
+ * problem with the graph edges scaled by 1/alpha, where alpha is the 
+ * current quotient.  Every vertex v of A has an edge from the source 
+ * with capacity p(v), and every vertex v of B has an edge to the sink 
+ * with capacity f*p(v) for FlowImprove and p(A)+1 for MQI, so B is always
+ * on the sink side.  The source side of the minimum cut has a smaller 
+ * quotient than alpha or the iteration stops.  The terminal capacities 
+ * never change and the graph capacities only increase, so the pseudoflow
+ * algorithm starts each max flow from the maximum flow of the last one.
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex
+ * @param ia the row connectivity points into ja
+ * @param weight the weight of each edge, the graph must be symmetric
+ * @param p the non-negative weight of each vertex, usually the degree
+ * @param set set[v] != 0 if v is in the initial set A
+ * @param mqi 1 for MQI and 0 for FlowImprove
+ * @param maxiter the maximum number of max flow problems
+ * @param improved improved[v] = 1 if v is in the improved set and 0 
+ *   otherwise
+ * @param cond the conductance cut(S)/min(p(S),p(B & ~S)) of the initial
+ *   set and each improved set, of length maxiter+1
+ * @param niter the number of improvements, so cond has niter+1 values
+ * @return an error code if possible
+ *   0: indicates success
+ *  -1: indicates a negative vertex weight, or that p(A) or p(B) is 0
+ */
+int flow_improve(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, double *weight,
+    double *p, int *set, int mqi, mbglIndex maxiter,
+    int *improved, double *cond, mbglIndex *niter)
+{
+    double pa = 0.0, pb = 0.0;
+    for (mbglIndex v=0; v<nverts; ++v) {
+        if (p[v] < 0) { return (-1); }
+        improved[v] = set[v] != 0;
+        if (improved[v]) { pa += p[v]; } else { pb += p[v]; }
+    }
+    if (pa <= 0 || pb <= 0) { return (-1); }
+
+    double cut, vol;
+    flow_improve_cut(nverts, ja, ia, weight, p, improved, &cut, &vol);
+    double alpha = cut/pa;
+    cond[0] = cut/(pa < pb ? pa : pb);
+    *niter = 0;
+
+    flow_network *net;
+    create_flow_network(nverts, ja, ia, &net);
+    mbglIndex s = nverts, t = nverts+1;
+    mbglIndex *fja = &net->ja[0], *fia = &net->ia[0], *rev = &net->rev[0];
+    std::vector<double> res(net->ja.size(), 0.0);
+
+    double f = pa/pb;
+    for (mbglIndex v=0; v<nverts; ++v) {
+        if (improved[v]) {
+            res[net->source_edge[v]] = p[v];
+        } else {
+            res[net->sink_edge[v]] = mqi ? pa+1.0 : f*p[v];
+        }
+    }
+
+    std::vector<int> side(nverts);
+    std::vector<char> visited(nverts+2);
+    mbglIndex *q = &net->queue[0];
+    double scale = 0.0;
+    for (mbglIndex iter=0; iter<maxiter && alpha > 0; ++iter) {
+        // increase the capacities of the graph edges to weight/alpha
+        double delta = 1.0/alpha - scale;
+        scale = 1.0/alpha;
+        for (mbglIndex k=0; k<net->nedges; ++k) {
+            if (weight[k] > 0) { res[net->edge[k]] += delta*weight[k]; }
+        }
+        pseudoflow_max_flow_warm(nverts+2, fja, fia, s, t, &res[0], rev);
+
+        // the source side are the vertices that cannot reach the sink
+        std::fill(visited.begin(), visited.end(), 0);
+        mbglIndex qhead = 0, qtail = 0;
+        visited[t] = 1;
+        q[qtail++] = t;
+        while (qhead != qtail) {
+            mbglIndex u = q[qhead++];
+            for (mbglIndex k=fia[u]; k<fia[u+1]; ++k) {
+                mbglIndex v = fja[k];
+                if (res[rev[k]] > 0 && !visited[v]) {
+                    visited[v] = 1;
+                    q[qtail++] = v;
+                }
+            }
+        }
+        double psa = 0.0, psb = 0.0;
+        for (mbglIndex v=0; v<nverts; ++v) {
+            side[v] = !visited[v];
+            if (!side[v]) { continue; }
+            if (set[v]) { psa += p[v]; } else { psb += p[v]; }
+        }
+        // the denominator is (p(S & A)p(B) - p(A)p(S & B))/p(B), so it is
+        // exactly 0 when S has all the vertices, and the iteration stops 
+        // unless the quotient drops by more than the rounding error
+        double d = mqi ? psa : (psa*pb - pa*psb)/pb;
+        if (d <= 0) { break; }
+        flow_improve_cut(nverts, ja, ia, weight, p, &side[0], &cut, &vol);
+        if (cut/d >= alpha*(1.0 - 1e-12)) { break; }
+
+        alpha = cut/d;
+        std::copy(side.begin(), side.end(), improved);
+        *niter = iter+1;
+        double other = pa + pb - vol;
+        cond[iter+1] = cut/(vol < other ? vol : other);
+    }
+
+    free_flow_network(net);
+    return (0);
+}
+
+/** Find the connected components of the positive weight edges for the 
+ * minimum cuts.
+ *
+ * @param comp comp[v] is the component of v
+ * @return the number of components
+ */
+static mbglIndex min_cut_components(mbglIndex nverts, mbglIndex *ja, 
+    mbglIndex *ia, double *weight, std::vector<mbglIndex>& comp)
+{
+    comp.assign(nverts, nverts);
+    std::vector<mbglIndex> queue(nverts);
+    mbglIndex ncomps = 0;
+    for (mbglIndex r=0; r<nverts; ++r) {
+        if (comp[r] != nverts) { continue; }
+        mbglIndex qhead = 0, qtail = 0;
+        comp[r] = ncomps;
+        queue[qtail++] = r;
+        while (qhead != qtail) {
+            mbglIndex u = queue[qhead++];
+            for (mbglIndex k=ia[u]; k<ia[u+1]; ++k) {
+                mbglIndex v = ja[k];
+                if (weight[k] > 0 && comp[v] == nverts) {
+                    comp[v] = ncomps;
+                    queue[qtail++] = v;
+                }
+            }
+        }
+        ++ncomps;
+    }
+    return (ncomps);
+}
+
+/** Find the representative of v with path compression. */
+inline mbglIndex min_cut_find(std::vector<mbglIndex>& parent, mbglIndex v)
+{
+    mbglIndex r = v;
+    while (parent[r] != r) { r = parent[r]; }
+    while (parent[v] != r) { mbglIndex p = parent[v]; parent[v] = r; v = p; }
+    return (r);
+}
+
+/** The Stoer-Wagner phases with the queue Q on the keys in key.
+ *
+ * The key of a vertex is kmax minus its connectivity to the vertices 
+ * already in the phase, so Q is a min-queue.  Each phase adds the most 
+ * connected vertex until all the vertices are added.  The cut of the 
+ * phase is the connectivity of the last vertex t, which is merged into 
+ * the second to last vertex s.  Each merge combines the adjacency lists,
+ * so the lists never hold more than the edges of the graph.
+ */
+template <class Queue>
+double stoer_wagner_phases(mbglIndex n, mbglIndex *ja, mbglIndex *ia, 
+    double *weight, Queue& Q, std::vector<double>& key, double kmax, 
+    int *side)
+{
+    typedef std::pair<mbglIndex, double> entry;
+    const mbglIndex none = n;
+    std::vector< std::vector<entry> > adj(n);
+    for (mbglIndex u=0; u<n; ++u) {
+        for (mbglIndex k=ia[u]; k<ia[u+1]; ++k) {
+            if (ja[k] != u && weight[k] > 0) { 
+                adj[u].push_back(entry(ja[k], weight[k])); 
+            }
+        }
+    }
+    std::vector<mbglIndex> parent(n), active(n), stamp(n, none);
+    std::vector<mbglIndex> merged_s, merged_t;
+    for (mbglIndex v=0; v<n; ++v) { parent[v] = v; active[v] = v; }
+    std::vector<double> acc(n, 0.0);
+    std::vector<mbglIndex> order;
+
+    double best = std::numeric_limits<double>::max();
+    mbglIndex best_phase = 0;
+    for (mbglIndex phase=0; active.size() > 1; ++phase) {
+        for (size_t i=0; i<active.size(); ++i) { 
+            key[active[i]] = kmax; 
+            Q.push(active[i]); 
+        }
+        mbglIndex s = none, t = none;
+        while (!Q.empty()) {
+            mbglIndex v = Q.top();
+            Q.pop();
+            stamp[v] = phase;
+            s = t; t = v;
+            for (size_t i=0; i<adj[v].size(); ++i) {
+                mbglIndex r = min_cut_find(parent, adj[v][i].first);
+                if (stamp[r] == phase) { continue; }
+                key[r] -= adj[v][i].second;
+                Q.update(r);
+            }
+        }
+        double cut = kmax - key[t];
+        if (cut < best) { best = cut; best_phase = phase; }
+
+        // merge t into s and combine their edges
+        merged_s.push_back(s);
+        merged_t.push_back(t);
+        parent[t] = s;
+        order.clear();
+        for (int pass=0; pass<2; ++pass) {
+            std::vector<entry>& list = pass == 0 ? adj[s] : adj[t];
+            for (size_t i=0; i<list.size(); ++i) {
+                mbglIndex r = min_cut_find(parent, list[i].first);
+                if (r == s) { continue; }
+                if (acc[r] == 0.0) { order.push_back(r); }
+                acc[r] += list[i].second;
+            }
+        }
+        adj[s].clear();
+        for (size_t i=0; i<order.size(); ++i) {
+            adj[s].push_back(entry(order[i], acc[order[i]]));
+            acc[order[i]] = 0.0;
+        }
+        std::vector<entry>().swap(adj[t]);
+        active.erase(std::find(active.begin(), active.end(), t));
+    }
+
+    // replay the merges before the best phase to find the side of t
+    for (mbglIndex v=0; v<n; ++v) { parent[v] = v; }
+    for (mbglIndex p=0; p<best_phase; ++p) { parent[merged_t[p]] = merged_s[p]; }
+    mbglIndex rt = min_cut_find(parent, merged_t[best_phase]);
+    for (mbglIndex v=0; v<n; ++v) { side[v] = min_cut_find(parent, v) == rt; }
+    return (best);
+}
+
+/** Run the Stoer-Wagner phases on a connected graph with at least two 
+ * vertices with a bucket queue or a d-ary heap.
+ *
+ * The bucket queue needs non-negative integer keys, so it is only used 
+ * when the weights are integers and their total is at most nverts + nnz.
+ */
+static double stoer_wagner_min_cut_help(mbglIndex nverts, mbglIndex *ja,
+    mbglIndex *ia, double *weight, int *side)
+{
+    using namespace boost;
+    mbglIndex nz = ia[nverts];
+    bool use_buckets = true;
+    double total = 0.0;
+    for (mbglIndex k=0; k<nz; ++k) {
+        if (weight[k] <= 0) { continue; }
+        if (floor(weight[k]) != weight[k]) { use_buckets = false; }
+        total += weight[k];
+    }
+    if (total > (double)nverts + (double)nz) { use_buckets = false; }
+
+    typedef iterator_property_map<double*, identity_property_map> KeyMap;
+    std::vector<double> key(nverts);
+    KeyMap km = make_iterator_property_map(&key[0], identity_property_map());
+    if (use_buckets) {
+        detail::integer_bucket_queue<mbglIndex, KeyMap, identity_property_map>
+            Q(nverts, km, identity_property_map());
+        return stoer_wagner_phases(nverts, ja, ia, weight, Q, key, total, 
+            side);
+    } else {
+        detail::indexed_d_ary_heap<mbglIndex, KeyMap, identity_property_map>
+            Q(nverts, km, identity_property_map());
+        return stoer_wagner_phases(nverts, ja, ia, weight, Q, key, 0.0, 
+            side);
+    }
+}
+
+/**
+ * Compute a global minimum cut of an undirected graph with the 
+ * Stoer-Wagner algorithm.
+ *
+ * Each of the nverts-1 phases orders the vertices by maximum adjacency 
+ * with a priority queue and merges the last two.  The queue is a bucket 
+ * queue for small integer weights and a 4-ary heap otherwise.  The total
+ * work is O(nverts*nnz*log(nverts)) with the heap.  A graph with more 
+ * than one connected component has a cut with value 0 around the first
+ * component.
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex
+ * @param ia the row connectivity points into ja
+ * @param weight the weight of each edge, the graph must be symmetric and
+ *   edges with weight <= 0 are ignored
+ * @param value the value of the minimum cut
+ * @param side side[v] = 1 if v is on one side of the cut and 0 otherwise
+ * @return an error code if possible
+ *   0: indicates success
+ *  -1: indicates the graph has fewer than 2 vertices
+ */
+int stoer_wagner_min_cut(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, double *weight,
+    double *value, int *side)
+{
+    if (nverts < 2) { return (-1); }
+    std::vector<mbglIndex> comp;
+    if (min_cut_components(nverts, ja, ia, weight, comp) > 1) {
+        for (mbglIndex v=0; v<nverts; ++v) { side[v] = comp[v] == 0; }
+        *value = 0.0;
+        return (0);
+    }
+    *value = stoer_wagner_min_cut_help(nverts, ja, ia, weight, side);
+    return (0);
+}
+
+/** An edge of a contracted graph for karger_stein_min_cut. */
+struct min_cut_edge
+{
+    mbglIndex u, v;
+    double w;
+    min_cut_edge(mbglIndex u_, mbglIndex v_, double w_) 
+        : u(u_), v(v_), w(w_) {}
+    bool operator<(const min_cut_edge& e) const 
+    { return (u < e.u || (u == e.u && v < e.v)); }
+};
+
+/** Contract random edges of a graph until it has target vertices.
+ *
+ * Each edge gets an exponential random key with rate equal to its 
+ * weight, and contracting the edges in the order of their keys picks 
+ * each contraction with probability proportional to the weight of the
+ * remaining edges.
+ *
+ * @param label label[v] is the vertex of v in the contracted graph
+ * @param sub the edges of the contracted graph with u < v
+ * @return the number of vertices in the contracted graph
+ */
+static mbglIndex karger_stein_contract(mbglIndex n, 
+    const std::vector<min_cut_edge>& edges, mbglIndex target, 
+    boost::mt19937& gen, std::vector<mbglIndex>& label, 
+    std::vector<min_cut_edge>& sub)
+{
+    boost::uniform_real<double> uniform(0.0, 1.0);
+    std::vector< std::pair<double, mbglIndex> > order(edges.size());
+    for (size_t i=0; i<edges.size(); ++i) {
+        order[i].first = -log(1.0 - uniform(gen))/edges[i].w;
+        order[i].second = (mbglIndex)i;
+    }
+    std::sort(order.begin(), order.end());
+
+    std::vector<mbglIndex> parent(n);
+    for (mbglIndex v=0; v<n; ++v) { parent[v] = v; }
+    mbglIndex ncomps = n;
+    for (size_t i=0; i<order.size() && ncomps > target; ++i) {
+        const min_cut_edge& e = edges[order[i].second];
+        mbglIndex ru = min_cut_find(parent, e.u), rv = min_cut_find(parent, e.v);
+        if (ru == rv) { continue; }
+        parent[rv] = ru;
+        --ncomps;
+    }
+
+    label.assign(n, n);
+    mbglIndex nsub = 0;
+    for (mbglIndex v=0; v<n; ++v) {
+        mbglIndex r = min_cut_find(parent, v);
+        if (label[r] == n) { label[r] = nsub++; }
+        label[v] = label[r];
+    }
+    sub.clear();
+    for (size_t i=0; i<edges.size(); ++i) {
+        mbglIndex a = label[edges[i].u], b = label[edges[i].v];
+        if (a == b) { continue; }
+        if (a > b) { std::swap(a, b); }
+        sub.push_back(min_cut_edge(a, b, edges[i].w));
+    }
+    // combine the parallel edges
+    std::sort(sub.begin(), sub.end());
+    size_t m = 0;
+    for (size_t i=0; i<sub.size(); ++i) {
+        if (m > 0 && sub[m-1].u == sub[i].u && sub[m-1].v == sub[i].v) {
+            sub[m-1].w += sub[i].w;
+        } else {
+            sub[m++] = sub[i];
+        }
+    }
+    sub.erase(sub.begin()+m, sub.end());
+    return (nsub);
+}
+
+/** One run of the recursive contraction algorithm on a graph with at 
+ * least two vertices.
+ *
+ * Small graphs use the Stoer-Wagner algorithm.  Otherwise the graph is 
+ * contracted to 1 + n/sqrt(2) vertices twice and each contracted graph 
+ * is solved recursively.  Below about 16 vertices, each contraction only
+ * removes one or two vertices and the recursion has many more leaves 
+ * than the (n/6)^2 of the analysis, so the Stoer-Wagner algorithm takes 
+ * over there.
+ */
+static double karger_stein_recurse(mbglIndex n, 
+    const std::vector<min_cut_edge>& edges, boost::mt19937& gen, 
+    std::vector<int>& side)
+{
+    side.resize(n);
+    if (edges.empty()) {
+        // the graph is disconnected
+        for (mbglIndex v=0; v<n; ++v) { side[v] = v == 0; }
+        return (0.0);
+    }
+    if (n <= 16) {
+        std::vector<mbglIndex> ia(n+1, 0), ja(2*edges.size());
+        std::vector<double> w(2*edges.size());
+        for (size_t i=0; i<edges.size(); ++i) {
+            ia[edges[i].u+1]++;
+            ia[edges[i].v+1]++;
+        }
+        for (mbglIndex v=0; v<n; ++v) { ia[v+1] += ia[v]; }
+        std::vector<mbglIndex> pos(ia.begin(), ia.end()-1);
+        for (size_t i=0; i<edges.size(); ++i) {
+            mbglIndex u = edges[i].u, v = edges[i].v;
+            ja[pos[u]] = v; w[pos[u]++] = edges[i].w;
+            ja[pos[v]] = u; w[pos[v]++] = edges[i].w;
+        }
+        double cut;
+        stoer_wagner_min_cut(n, &ja[0], &ia[0], &w[0], &cut, &side[0]);
+        return (cut);
+    }
+
+    mbglIndex target = (mbglIndex)ceil(1.0 + (double)n/sqrt(2.0));
+    double best = std::numeric_limits<double>::max();
+    std::vector<mbglIndex> label;
+    std::vector<min_cut_edge> sub;
+    std::vector<int> subside;
+    for (int trial=0; trial<2; ++trial) {
+        mbglIndex nsub = karger_stein_contract(n, edges, target, gen, 
+            label, sub);
+        double cut = karger_stein_recurse(nsub, sub, gen, subside);
+        if (cut < best) {
+            best = cut;
+            for (mbglIndex v=0; v<n; ++v) { side[v] = subside[label[v]]; }
+        }
+    }
+    return (best);
+}
+
+/**
+ * Compute a global minimum cut of an undirected graph with the 
+ * randomized recursive contraction algorithm of Karger and Stein.
+ *
+ * Each trial finds a minimum cut with probability on the order of 
+ * 1/log(nverts), so the best cut from (log2 nverts)^2 trials is a 
+ * minimum cut with high probability.  Each trial takes 
+ * O(nverts^2 log(nverts)) work for any number of edges, so this method 
+ * is faster than stoer_wagner_min_cut on large dense graphs.  The trials
+ * run in parallel with OpenMP.  Each trial has its own random seed, so 
+ * the output does not depend on the number of threads.
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex
+ * @param ia the row connectivity points into ja
+ * @param weight the weight of each edge, the graph must be symmetric and
+ *   edges with weight <= 0 are ignored
+ * @param ntrials the number of trials, or 0 for ceil((log2 nverts)^2)
+ * @param seed the random seed
+ * @param value the value of the smallest cut found
+ * @param side side[v] = 1 if v is on one side of the cut and 0 otherwise
+ * @return an error code if possible
+ *   0: indicates success
+ *  -1: indicates the graph has fewer than 2 vertices
+ */
+int karger_stein_min_cut(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, double *weight,
+    mbglIndex ntrials, unsigned int seed, double *value, int *side)
+{
+    if (nverts < 2) { return (-1); }
+    std::vector<mbglIndex> comp;
+    if (min_cut_components(nverts, ja, ia, weight, comp) > 1) {
+        for (mbglIndex v=0; v<nverts; ++v) { side[v] = comp[v] == 0; }
+        *value = 0.0;
+        return (0);
+    }
+    if (ntrials == 0) {
+        double l = log((double)nverts)/log(2.0);
+        ntrials = (mbglIndex)ceil(l*l);
+    }
+
+    std::vector<min_cut_edge> edges;
+    for (mbglIndex u=0; u<nverts; ++u) {
+        for (mbglIndex k=ia[u]; k<ia[u+1]; ++k) {
+            if (u < ja[k] && weight[k] > 0) { 
+                edges.push_back(min_cut_edge(u, ja[k], weight[k])); 
+            }
+        }
+    }
+
+    double best = std::numeric_limits<double>::max();
+    ptrdiff_t best_trial = (ptrdiff_t)ntrials;
+    #pragma omp parallel
+    {
+        std::vector<int> tside;
+        #pragma omp for schedule(dynamic, 1)
+        for (ptrdiff_t b=0; b<(ptrdiff_t)ntrials; ++b) {
+            boost::mt19937 gen(seed + 2654435761u*(unsigned int)b);
+            double cut = karger_stein_recurse(nverts, edges, gen, tside);
+            #pragma omp critical
+            {
+                if (cut < best || (cut == best && b < best_trial)) {
+                    best = cut;
+                    best_trial = b;
+                    std::copy(tside.begin(), tside.end(), side);
+                }
+            }
+        }
+    }
+    *value = best;
+    return (0);
+}
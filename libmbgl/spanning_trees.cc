@@ -18,6 +18,8 @@
  *  2007-11-16: Added root vertex option to prim's MST
  *  2008-10-01: Changed copy_to_ijval to use mbglIndex instead of int.
  *    Removed old commented regions.
+ *  2026-10-19: Added a parallel Boruvka minimum spanning forest
+ *    Added Filter-Kruskal with parallel sorting and edge indices
  */
 
 #include "include/matlab_bgl.h"
@@ -29,6 +31,12 @@
 #include <boost/graph/prim_minimum_spanning_tree.hpp>
 
 #include <vector>
+#include <algorithm>
+#include <cstddef>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif /* _OPENMP */
 
 /*template <class Graph, class Edge>
 class spanning_tree_insert_iterator
@@ -174,3 +182,401 @@ int prim_mst(
     return prim_mst_rooted(nverts, ja, ia, weight, i, j, val, nedges, 0);
 }
 
+
+/**
+ * Order undirected edges by weight and then by their endpoints.
+ *
+ * Both copies of an edge in a symmetric matrix compare equal, and
+ * different edges never do, so each component has a unique lightest edge.
+ */
+static inline bool boruvka_edge_less(mbglIndex *ja, double *weight,
+    mbglIndex u1, mbglIndex k1, mbglIndex u2, mbglIndex k2)
+{
+    if (weight[k1] != weight[k2]) { return (weight[k1] < weight[k2]); }
+    mbglIndex a1 = u1 < ja[k1] ? u1 : ja[k1], b1 = u1 < ja[k1] ? ja[k1] : u1;
+    mbglIndex a2 = u2 < ja[k2] ? u2 : ja[k2], b2 = u2 < ja[k2] ? ja[k2] : u2;
+    if (a1 != a2) { return (a1 < a2); }
+    return (b1 < b2);
+}
+
+/**
+ * Compute a minimum spanning forest with a parallel Boruvka algorithm.
+ *
+ * Each round finds the lightest edge leaving every vertex in parallel,
+ * reduces those to the lightest edge leaving each component, hooks every
+ * component onto its neighbor across that edge, and contracts the hooked
+ * trees by parallel pointer jumping.  There are at most log2(nverts)
+ * rounds.  Vertices whose edges are all inside their component are
+ * dropped from later rounds.  The output does not depend on the number of
+ * threads.
+ *
+ * The weights must be symmetric.
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex
+ * @param ia the row connectivity points into ja
+ * @param weight the weight of each edge
+ * @param i the source of each forest edge, length nverts-1
+ * @param j the target of each forest edge, length nverts-1
+ * @param val the weight of each forest edge, length nverts-1
+ * @param nedges the number of forest edges
+ * @return an error code if possible, -1 if the weights are not symmetric
+ */
+int boruvka_mst(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, double *weight, /* connectivity params */
+    mbglIndex* i, mbglIndex* j, double* val, mbglIndex *nedges /* tree output */)
+{
+    mbglIndex nz = ia[nverts];
+    std::vector<mbglIndex> comp(nverts), parent(nverts), jump(nverts);
+    std::vector<mbglIndex> best(nverts), cbest(nverts, nz), csrc(nverts);
+    std::vector<mbglIndex> active(nverts), roots;
+    std::vector<char> top(nverts);
+    for (mbglIndex v=0; v<nverts; ++v) { comp[v] = v; parent[v] = v; active[v] = v; }
+
+    *nedges = 0;
+    while (!active.empty()) {
+        // find the lightest edge leaving each vertex's component
+        ptrdiff_t nactive = (ptrdiff_t)active.size();
+        #pragma omp parallel for schedule(dynamic, 256) if (nactive > 1024)
+        for (ptrdiff_t a=0; a<nactive; ++a) {
+            mbglIndex v = active[a], c = comp[v], b = nz;
+            for (mbglIndex k=ia[v]; k<ia[v+1]; ++k) {
+                if (comp[ja[k]] != c &&
+                    (b == nz || boruvka_edge_less(ja, weight, v, k, v, b))) {
+                    b = k;
+                }
+            }
+            best[v] = b;
+        }
+
+        // reduce to the lightest edge per component, the vertices keep
+        // their order so the output is deterministic
+        roots.clear();
+        ptrdiff_t nkeep = 0;
+        for (ptrdiff_t a=0; a<nactive; ++a) {
+            mbglIndex v = active[a], c = comp[v], k = best[v];
+            if (k == nz) { continue; }
+            active[nkeep++] = v;
+            if (cbest[c] == nz) {
+                roots.push_back(c);
+                cbest[c] = k; csrc[c] = v;
+            } else if (boruvka_edge_less(ja, weight, v, k, csrc[c], cbest[c])) {
+                cbest[c] = k; csrc[c] = v;
+            }
+        }
+        active.resize((size_t)nkeep);
+        if (roots.empty()) { break; }
+
+        // hook each component onto its neighbor, two components that pick
+        // each other pick the same edge and the smaller one stays a root
+        ptrdiff_t nroots = (ptrdiff_t)roots.size();
+        #pragma omp parallel if (nroots > 1024)
+        {
+            #pragma omp for schedule(static)
+            for (ptrdiff_t r=0; r<nroots; ++r) {
+                mbglIndex c = roots[r];
+                parent[c] = comp[ja[cbest[c]]];
+            }
+            #pragma omp for schedule(static)
+            for (ptrdiff_t r=0; r<nroots; ++r) {
+                mbglIndex c = roots[r], d = parent[c];
+                jump[c] = (parent[d] == c && c < d) ? c : d;
+            }
+            #pragma omp for schedule(static)
+            for (ptrdiff_t r=0; r<nroots; ++r) {
+                mbglIndex c = roots[r];
+                parent[c] = jump[c];
+                top[c] = (jump[c] == c);
+            }
+        }
+
+        // flatten the hooked trees, a forest needs at most log2 rounds
+        // and anything longer is a cycle from asymmetric weights
+        int changed = 1;
+        for (size_t round=0; changed; ++round) {
+            if (round > 8*sizeof(mbglIndex)) { return (-1); }
+            changed = 0;
+            #pragma omp parallel if (nroots > 1024)
+            {
+                #pragma omp for schedule(static) reduction(|:changed)
+                for (ptrdiff_t r=0; r<nroots; ++r) {
+                    mbglIndex c = roots[r];
+                    jump[c] = parent[parent[c]];
+                    if (jump[c] != parent[c]) { changed = 1; }
+                }
+                #pragma omp for schedule(static)
+                for (ptrdiff_t r=0; r<nroots; ++r) {
+                    parent[roots[r]] = jump[roots[r]];
+                }
+            }
+        }
+
+        // a cycle whose length is a power of two flattens to roots that
+        // did not stay roots when hooking
+        for (ptrdiff_t r=0; r<nroots; ++r) {
+            mbglIndex c = roots[r], k = cbest[c];
+            if (parent[c] != c) {
+                i[*nedges] = csrc[c];
+                j[*nedges] = ja[k];
+                val[*nedges] = weight[k];
+                ++(*nedges);
+            } else if (!top[c]) {
+                return (-1);
+            }
+            cbest[c] = nz;
+        }
+
+        #pragma omp parallel for schedule(static) if (nverts > 4096)
+        for (ptrdiff_t v=0; v<(ptrdiff_t)nverts; ++v) {
+            comp[v] = parent[comp[v]];
+        }
+    }
+
+    return (0);
+}
+
+/** An undirected edge for Filter-Kruskal, u < v and k is its index in ja. */
+struct filter_kruskal_edge
+{
+    double w;
+    mbglIndex u, v, k;
+
+    /** Use the same order as Boruvka so both give the same forest. */
+    bool operator<(const filter_kruskal_edge& e) const
+    {
+        if (w != e.w) { return (w < e.w); }
+        if (u != e.u) { return (u < e.u); }
+        return (v < e.v);
+    }
+};
+
+/**
+ * Sort with std::sort on one block per thread and then merge the
+ * blocks pairwise in parallel.
+ * @param buf scratch space as long as the range
+ */
+template <class T>
+static void filter_kruskal_sort(T* first, ptrdiff_t n, T* buf)
+{
+    ptrdiff_t nblocks = 1;
+#ifdef _OPENMP
+    nblocks = (ptrdiff_t)omp_get_max_threads();
+#endif /* _OPENMP */
+    if (nblocks < 2 || n < 8192) { std::sort(first, first+n); return; }
+
+    std::vector<ptrdiff_t> bounds(nblocks+1);
+    for (ptrdiff_t b=0; b<=nblocks; ++b) { bounds[b] = (n/nblocks)*b + (n%nblocks)*b/nblocks; }
+
+    #pragma omp parallel for schedule(static, 1)
+    for (ptrdiff_t b=0; b<nblocks; ++b) {
+        std::sort(first+bounds[b], first+bounds[b+1]);
+    }
+    T *src = first, *dst = buf;
+    for (ptrdiff_t width=1; width<nblocks; width*=2) {
+        #pragma omp parallel for schedule(static, 1)
+        for (ptrdiff_t b=0; b<nblocks; b+=2*width) {
+            ptrdiff_t lo = bounds[b];
+            ptrdiff_t mid = bounds[std::min(b+width, nblocks)];
+            ptrdiff_t hi = bounds[std::min(b+2*width, nblocks)];
+            std::merge(src+lo, src+mid, src+mid, src+hi, dst+lo);
+        }
+        std::swap(src, dst);
+    }
+    if (src != first) { std::copy(src, src+n, first); }
+}
+
+/**
+ * Move the edges that satisfy pred to the front in parallel, keeping their
+ * order.  The other edges follow if keep_rest is set and are dropped
+ * otherwise.
+ * @return the number of edges that satisfy pred
+ */
+template <class T, class Predicate>
+static ptrdiff_t filter_kruskal_partition(T* first, ptrdiff_t n, T* buf,
+    Predicate pred, bool keep_rest)
+{
+    ptrdiff_t nblocks = 1;
+#ifdef _OPENMP
+    nblocks = (ptrdiff_t)omp_get_max_threads();
+#endif /* _OPENMP */
+    if (n < 8192) { nblocks = 1; }
+    std::vector<ptrdiff_t> bounds(nblocks+1), ntrue(nblocks+1, 0);
+    for (ptrdiff_t b=0; b<=nblocks; ++b) { bounds[b] = (n/nblocks)*b + (n%nblocks)*b/nblocks; }
+
+    #pragma omp parallel for schedule(static, 1) if (nblocks > 1)
+    for (ptrdiff_t b=0; b<nblocks; ++b) {
+        ptrdiff_t c = 0;
+        for (ptrdiff_t e=bounds[b]; e<bounds[b+1]; ++e) { c += pred(first[e]) ? 1 : 0; }
+        ntrue[b+1] = c;
+    }
+    for (ptrdiff_t b=0; b<nblocks; ++b) { ntrue[b+1] += ntrue[b]; }
+    ptrdiff_t total = ntrue[nblocks];
+    ptrdiff_t nout = keep_rest ? n : total;
+
+    #pragma omp parallel for schedule(static, 1) if (nblocks > 1)
+    for (ptrdiff_t b=0; b<nblocks; ++b) {
+        ptrdiff_t t = ntrue[b], f = total + bounds[b] - ntrue[b];
+        for (ptrdiff_t e=bounds[b]; e<bounds[b+1]; ++e) {
+            if (pred(first[e])) { buf[t++] = first[e]; }
+            else if (keep_rest) { buf[f++] = first[e]; }
+        }
+    }
+    #pragma omp parallel for schedule(static) if (nblocks > 1)
+    for (ptrdiff_t e=0; e<nout; ++e) { first[e] = buf[e]; }
+
+    return (total);
+}
+
+/** The union-find forest and tree output of a Filter-Kruskal computation. */
+struct filter_kruskal_state
+{
+    std::vector<mbglIndex> parent;
+    std::vector<unsigned char> rank;
+    mbglIndex *i, *j, *ei, nedges, maxedges;
+    double *val;
+
+    /** Find without path compression so threads can share the forest. */
+    mbglIndex root(mbglIndex v) const
+    {
+        while (parent[v] != v) { v = parent[v]; }
+        return (v);
+    }
+
+    mbglIndex find(mbglIndex v)
+    {
+        while (parent[v] != v) { parent[v] = parent[parent[v]]; v = parent[v]; }
+        return (v);
+    }
+
+    /** Run Kruskal's algorithm on sorted edges. */
+    void kruskal(filter_kruskal_edge* e, ptrdiff_t n)
+    {
+        for (ptrdiff_t a=0; a<n && nedges<maxedges; ++a) {
+            mbglIndex ru = find(e[a].u), rv = find(e[a].v);
+            if (ru == rv) { continue; }
+            if (rank[ru] < rank[rv]) { std::swap(ru, rv); }
+            parent[rv] = ru;
+            if (rank[ru] == rank[rv]) { ++rank[ru]; }
+            i[nedges] = e[a].u;
+            j[nedges] = e[a].v;
+            val[nedges] = e[a].w;
+            ei[nedges] = e[a].k;
+            ++nedges;
+        }
+    }
+};
+
+struct filter_kruskal_not_above
+{
+    filter_kruskal_edge pivot;
+    filter_kruskal_not_above(const filter_kruskal_edge& p) : pivot(p) {}
+    bool operator()(const filter_kruskal_edge& e) const { return !(pivot < e); }
+};
+
+struct filter_kruskal_crossing
+{
+    const filter_kruskal_state& st;
+    filter_kruskal_crossing(const filter_kruskal_state& s) : st(s) {}
+    bool operator()(const filter_kruskal_edge& e) const
+    { return (st.root(e.u) != st.root(e.v)); }
+};
+
+/**
+ * Split the edges at a pivot, solve the light half, drop the heavy edges
+ * that the light half has already connected and then solve the rest.
+ * Small sets, or sets not much larger than the number of tree edges still
+ * missing, are sorted directly.
+ */
+static void filter_kruskal(filter_kruskal_edge* e, ptrdiff_t n,
+    filter_kruskal_edge* buf, filter_kruskal_state& st)
+{
+    if (n == 0 || st.nedges == st.maxedges) { return; }
+    if (n <= 4096 || n <= 2*(ptrdiff_t)(st.maxedges - st.nedges)) {
+        filter_kruskal_sort(e, n, buf);
+        st.kruskal(e, n);
+        return;
+    }
+
+    // the median of a deterministic sample keeps the output independent
+    // of the number of threads
+    filter_kruskal_edge sample[31];
+    for (ptrdiff_t s=0; s<31; ++s) { sample[s] = e[(n-1)*s/30]; }
+    std::nth_element(sample, sample+15, sample+31);
+
+    ptrdiff_t nlight = filter_kruskal_partition(e, n, buf,
+        filter_kruskal_not_above(sample[15]), true);
+    if (nlight == n) {
+        filter_kruskal_sort(e, n, buf);
+        st.kruskal(e, n);
+        return;
+    }
+    filter_kruskal(e, nlight, buf, st);
+    if (st.nedges == st.maxedges) { return; }
+    ptrdiff_t nheavy = filter_kruskal_partition(e+nlight, n-nlight, buf,
+        filter_kruskal_crossing(st), false);
+    filter_kruskal(e+nlight, nheavy, buf, st);
+}
+
+/**
+ * Compute a minimum spanning forest with the Filter-Kruskal algorithm.
+ *
+ * Filter-Kruskal splits the edges at a pivot weight and solves the light
+ * edges first.  Then it discards the heavy edges that join vertices already
+ * connected and only sorts the heavy edges that remain.  Sorting and
+ * filtering use OpenMP.  Ties are broken by vertex numbers, so the forest is
+ * the same as from boruvka_mst.
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex
+ * @param ia the row connectivity points into ja
+ * @param weight the weight of each edge
+ * @param i the source of each forest edge, length nverts-1
+ * @param j the target of each forest edge, length nverts-1
+ * @param val the weight of each forest edge, length nverts-1
+ * @param ei the index of each forest edge in ja, length nverts-1
+ * @param nedges the number of forest edges
+ * @return an error code if possible
+ */
+int filter_kruskal_mst(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, double *weight, /* connectivity params */
+    mbglIndex* i, mbglIndex* j, double* val, mbglIndex* ei, /* tree output */
+    mbglIndex *nedges)
+{
+    // each undirected edge appears once, from its smaller endpoint
+    std::vector<mbglIndex> offset(nverts+1, 0);
+    #pragma omp parallel for schedule(dynamic, 1024) if (nverts > 4096)
+    for (ptrdiff_t u=0; u<(ptrdiff_t)nverts; ++u) {
+        mbglIndex c = 0;
+        for (mbglIndex k=ia[u]; k<ia[u+1]; ++k) { if ((mbglIndex)u < ja[k]) { ++c; } }
+        offset[u+1] = c;
+    }
+    for (mbglIndex u=0; u<nverts; ++u) { offset[u+1] += offset[u]; }
+
+    std::vector<filter_kruskal_edge> edges(offset[nverts]), buf(offset[nverts]);
+    #pragma omp parallel for schedule(dynamic, 1024) if (nverts > 4096)
+    for (ptrdiff_t u=0; u<(ptrdiff_t)nverts; ++u) {
+        mbglIndex a = offset[u];
+        for (mbglIndex k=ia[u]; k<ia[u+1]; ++k) {
+            if ((mbglIndex)u < ja[k]) {
+                edges[a].w = weight[k]; edges[a].u = (mbglIndex)u;
+                edges[a].v = ja[k]; edges[a].k = k;
+                ++a;
+            }
+        }
+    }
+
+    filter_kruskal_state st;
+    st.parent.resize(nverts);
+    st.rank.resize(nverts, 0);
+    for (mbglIndex v=0; v<nverts; ++v) { st.parent[v] = v; }
+    st.i = i; st.j = j; st.val = val; st.ei = ei;
+    st.nedges = 0;
+    st.maxedges = nverts > 0 ? nverts-1 : 0;
+
+    if (!edges.empty()) {
+        filter_kruskal(&edges[0], (ptrdiff_t)edges.size(), &buf[0], st);
+    }
+
+    *nedges = st.nedges;
+    return (0);
+}
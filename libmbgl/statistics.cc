@@ -11,6 +11,20 @@
  *  2007-07-05: Implemented core_numbers
  *  2007-07-11: Implemented directed and weighted clustering coefficients
  *  2007-07-12: Implemented dominator tree
+ *  2026-10-19: Implemented sampled clustering coefficients
+ *  2026-10-19: Implemented triangle counts, listing, and k-truss numbers
+ *  2026-10-19: Implemented parallel core numbers without removal times
+ *  2026-10-19: Switched weighted core numbers to bucket and d-ary heap queues
+ *  2026-10-19: Implemented incremental core numbers
+ *  2026-10-19: Parallelized betweenness centrality over the sources
+ *  2026-10-19: Implemented sampled approximate betweenness centrality
+ *  2026-10-19: Implemented closeness and harmonic centrality
+ *  2026-10-19: Implemented PageRank
+ *  2026-10-19: Implemented push-based local personalized PageRank
+ *  2026-10-19: Implemented Hopcroft-Karp bipartite matching
+ *  2026-10-19: Added Karp-Sipser and parallel greedy initial matchings
+ *  2026-10-19: Implemented Suitor approximate weighted matching
+ *  2026-10-19: Implemented semi-NCA dominator trees for batches of roots
  */
 
 #include "include/matlab_bgl.h"
@@ -20,6 +34,11 @@
 #include <yasmic/iterator_utility.hpp>
 
 #include <vector>
+#include <set>
+#include <map>
+#include <queue>
+#include <functional>
+#include <limits>
 
 #include <boost/graph/iteration_macros.hpp>
 //#include <boost/graph/betweenness_centrality.hpp>
@@ -32,10 +51,23 @@
 #include <yasmic/boost_mod/core_numbers.hpp>
 #include <boost/graph/dominator_tree.hpp>
 
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/uniform_real.hpp>
+#include <boost/unordered_map.hpp>
+
 #include <iostream>
+#include <algorithm>
 
 #include <math.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif /* _MSC_VER */
+#endif /* _OPENMP */
+
 template <class Vertex, class IndMap>
 struct in_indicator_pred
 	: public std::unary_function<Vertex, bool>
@@ -395,8 +427,199 @@ int directed_clustering_coefficients(
     return (0);
 }
 
+/** Test for the edge (u,w) by scanning the shorter adjacency list.
+ * The graph must be symmetric.
+ */
+static bool csr_has_edge(mbglIndex u, mbglIndex w,
+    const mbglIndex *ja, const mbglIndex *ia)
+{
+    if (ia[u+1]-ia[u] > ia[w+1]-ia[w]) { std::swap(u,w); }
+    for (mbglIndex k=ia[u]; k<ia[u+1]; ++k) {
+        if (ja[k] == w) { return true; }
+    }
+    return false;
+}
+
+/** Build the index of the reverse edge (v,u) for each edge (u,v).
+ *
+ * For a symmetric graph, rev[rev[k]] == k.  Edges without a reverse
+ * edge get the index ia[nverts].
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex
+ * @param ia the row connectivity points into ja
+ * @param rev the reverse edge index, length ia[nverts]
+ */
+static void build_reverse_edge_index(
+    mbglIndex nverts, const mbglIndex *ja, const mbglIndex *ia,
+    mbglIndex *rev)
+{
+    mbglIndex nz = ia[nverts];
+    // bucket the edges by target, so tsrc[tp[v]..tp[v+1]-1] are the
+    // sources of edges into v and tk gives their position
+    std::vector<mbglIndex> tp(nverts+1), tsrc(nz), tk(nz);
+    for (mbglIndex k=0; k<nz; ++k) { ++tp[ja[k]+1]; }
+    for (mbglIndex v=0; v<nverts; ++v) { tp[v+1] += tp[v]; }
+    for (mbglIndex u=0; u<nverts; ++u) {
+        for (mbglIndex k=ia[u]; k<ia[u+1]; ++k) {
+            mbglIndex p = tp[ja[k]]++;
+            tsrc[p] = u; tk[p] = k;
+        }
+    }
+    for (mbglIndex v=nverts; v>0; --v) { tp[v] = tp[v-1]; }
+    tp[0] = 0;
+
+    #pragma omp parallel
+    {
+        std::vector<mbglIndex> mark(nverts, nz);
+        #pragma omp for schedule(dynamic,256)
+        for (ptrdiff_t vi=0; vi<(ptrdiff_t)nverts; ++vi) {
+            mbglIndex v = (mbglIndex)vi;
+            for (mbglIndex k=ia[v]; k<ia[v+1]; ++k) { mark[ja[k]] = k; }
+            for (mbglIndex p=tp[v]; p<tp[v+1]; ++p) { rev[tk[p]] = mark[tsrc[p]]; }
+            for (mbglIndex k=ia[v]; k<ia[v+1]; ++k) { mark[ja[k]] = nz; }
+        }
+    }
+}
+
+/** Pick a random wedge (u,v,w) centered at v and check if it is closed.
+ * Self-loops are rejected, so v must have at least two non-loop
+ * neighbors.
+ */
+template <class RandomGen>
+bool sample_closed_wedge(mbglIndex v, const mbglIndex *ja, const mbglIndex *ia,
+    RandomGen& gen)
+{
+    boost::uniform_int<mbglIndex> pick(0, ia[v+1]-ia[v]-1);
+    mbglIndex i, j;
+    do { i = pick(gen); } while (ja[ia[v]+i] == v);
+    do { j = pick(gen); } while (j == i || ja[ia[v]+j] == v);
+    return csr_has_edge(ja[ia[v]+i], ja[ia[v]+j], ja, ia);
+}
+
+/** Estimate clustering coefficients by sampling wedges
+ *
+ * A wedge is a path of length two (u,v,w) and it is closed if the edge
+ * (u,w) exists.  With global=0, we pick a vertex uniformly at random and
+ * then a wedge at that vertex, which estimates the mean of the exact
+ * clustering_coefficients output (vertices with degree < 2 count as 0).
+ * With global=1, we pick a vertex with probability proportional to the
+ * number of wedges it centers, which estimates the global clustering
+ * coefficient (transitivity), 3*triangles/wedges.
+ *
+ * The cost of each sample is the smallest degree of a pair of
+ * neighbors, so the runtime does not depend on the number of triangles.
+ * The confidence interval comes from Hoeffding's inequality and so it
+ * holds for any graph.  The samples are split into a fixed set of
+ * blocks with their own random seeds, so the output does not depend on
+ * the number of threads.
+ *
+ * The graph must be undirected.
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex
+ * @param ia the row connectivity points into ja
+ * @param global 0 to estimate the average clustering coefficient and
+ *   1 to estimate the global clustering coefficient
+ * @param nsamples the number of wedges to sample, or 0 to pick the
+ *   number of samples from tol and conf
+ * @param tol the half-width of the confidence interval when nsamples = 0
+ * @param conf the confidence level of the interval, 0 < conf < 1
+ * @param seed the random seed
+ * @param cc the estimate of the clustering coefficient
+ * @param ci the half-width of the confidence interval at level conf
+ *   (optional)
+ * @param nsamples_used the number of samples drawn (optional)
+ * @return an error code if possible
+ *   0: indicates success
+ *  -1: indicates a parameter error with nsamples, tol, or conf
+ */
+int sampled_clustering_coefficients(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
+    int global, mbglIndex nsamples, double tol, double conf,
+    unsigned int seed, double *cc, double *ci, mbglIndex *nsamples_used)
+{
+    if (!cc || conf <= 0.0 || conf >= 1.0) { return (-1); }
+    if (nsamples == 0) {
+        if (tol <= 0.0) { return (-1); }
+        nsamples = (mbglIndex)ceil(log(2.0/(1.0-conf))/(2.0*tol*tol));
+    }
+
+    *cc = 0.0;
+    if (ci) { *ci = 0.0; }
+    if (nsamples_used) { *nsamples_used = 0; }
+
+    // the degree of each vertex without self-loops and the cumulative
+    // number of wedges for the degree weighted sampling
+    std::vector<mbglIndex> degs(nverts);
+    std::vector<double> wedges(nverts);
+    double total_wedges = 0.0;
+    for (mbglIndex v=0; v<nverts; ++v) {
+        degs[v] = ia[v+1]-ia[v];
+        for (mbglIndex k=ia[v]; k<ia[v+1]; ++k) {
+            if (ja[k] == v) { --degs[v]; }
+        }
+        double d = (double)degs[v];
+        total_wedges += d*(d-1.0)/2.0;
+        wedges[v] = total_wedges;
+    }
+    if (total_wedges == 0.0) { return (0); }
+
+    const mbglIndex max_blocks = 256;
+    mbglIndex nblocks = (std::min)(nsamples, max_blocks);
+    std::vector<mbglIndex> closed(nblocks);
+
+    #pragma omp parallel for schedule(dynamic,1)
+    for (ptrdiff_t b=0; b<(ptrdiff_t)nblocks; ++b) {
+        boost::mt19937 gen(seed + 2654435761u*(unsigned int)b);
+        boost::uniform_int<mbglIndex> pick_vertex(0, nverts-1);
+        boost::uniform_real<double> pick_wedge(0.0, total_wedges);
+        mbglIndex bsamples = nsamples/nblocks +
+            ((mbglIndex)b < nsamples%nblocks ? 1 : 0);
+        mbglIndex bclosed = 0;
+        for (mbglIndex s=0; s<bsamples; ++s) {
+            mbglIndex v;
+            if (global) {
+                v = (mbglIndex)(std::upper_bound(wedges.begin(), wedges.end(),
+                        pick_wedge(gen)) - wedges.begin());
+                if (v >= nverts) { v = nverts-1; }
+                // skip over vertices without wedges
+                while (degs[v] < 2) { --v; }
+            } else {
+                v = pick_vertex(gen);
+                if (degs[v] < 2) { continue; }
+            }
+            if (sample_closed_wedge(v, ja, ia, gen)) { ++bclosed; }
+        }
+        closed[b] = bclosed;
+    }
+
+    mbglIndex nclosed = 0;
+    for (mbglIndex b=0; b<nblocks; ++b) { nclosed += closed[b]; }
+
+    *cc = (double)nclosed/(double)nsamples;
+    if (ci) { *ci = sqrt(log(2.0/(1.0-conf))/(2.0*(double)nsamples)); }
+    if (nsamples_used) { *nsamples_used = nsamples; }
+
+    return (0);
+}
+
 
 
+/** Compute the betweenness centrality of all vertices and edges
+ *
+ * This function uses Brandes' algorithm with the sources distributed
+ * among OpenMP threads.  Each thread accumulates its own copy of the
+ * centrality values and the copies are summed at the end.
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex
+ * @param ia the row connectivity points into ja
+ * @param weight the weight of each edge, or NULL for an unweighted graph
+ * @param centrality the vertex centrality, length nverts
+ * @param ecentrality the edge centrality (optional), length nnz
+ * @return an error code if possible
+ */
 int betweenness_centrality(
     mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, double *weight, /* connectivity params */
     double *centrality, double *ecentrality)
@@ -410,367 +633,2286 @@ int betweenness_centrality(
     if (weight)
     {
         if (ecentrality) {
-            brandes_betweenness_centrality(g,
-	        		centrality_map(centrality)
-                    .weight_map(
-                        make_iterator_property_map(weight,
-                            get(edge_index,g)))
-                    .edge_centrality_map(
-                        make_iterator_property_map(
-                            ecentrality, get(edge_index, g))));
+            parallel_brandes_betweenness_centrality(g,
+                make_iterator_property_map(centrality, get(vertex_index, g)),
+                make_iterator_property_map(ecentrality, get(edge_index, g)),
+                get(vertex_index, g), get(edge_index, g),
+                make_iterator_property_map(weight, get(edge_index, g)));
         } else {
-            brandes_betweenness_centrality(g,
-	        		centrality_map(centrality)
-                    .weight_map(
-                        make_iterator_property_map(weight,
-                            get(edge_index,g))));
+            parallel_brandes_betweenness_centrality(g,
+                make_iterator_property_map(centrality, get(vertex_index, g)),
+                dummy_property_map(),
+                get(vertex_index, g), get(edge_index, g),
+                make_iterator_property_map(weight, get(edge_index, g)));
         }
     }
     else
     {
         if (ecentrality) {
-            brandes_betweenness_centrality(g,
-			    	centrality_map(centrality)
-                    .edge_centrality_map(
-                        make_iterator_property_map(
-                            ecentrality, get(edge_index, g))));
+            parallel_brandes_betweenness_centrality(g,
+                make_iterator_property_map(centrality, get(vertex_index, g)),
+                make_iterator_property_map(ecentrality, get(edge_index, g)),
+                get(vertex_index, g), get(edge_index, g));
         } else {
-            brandes_betweenness_centrality(g,
-			    	make_iterator_property_map(centrality,
-				    	get(vertex_index, g)));
+            parallel_brandes_betweenness_centrality(g,
+                make_iterator_property_map(centrality, get(vertex_index, g)),
+                dummy_property_map(),
+                get(vertex_index, g), get(edge_index, g));
         }
     }
 
     return (0);
 }
 
-/**
- * Test for a topological order or topological sort of a graph.
+/** Estimate betweenness centrality from a sample of sources
  *
- * This function will also test if the graph is a dag.  If the
- * rev_order parameter is null, then the actual topological order
- * is ignored and the function just tests for a dag.
+ * The sources are drawn with replacement in rounds that double in size
+ * until there are cap sources.  After each round, an empirical Bernstein
+ * bound on the sampled dependencies checks if the estimate is accurate
+ * enough to stop early.  The centrality maps hold the unscaled sums.
  *
- * @param nverts the number of vertices in the graph
- * @param ja the connectivity for each vertex
- * @param ia the row connectivity points into ja
- * @param topo_order a topological order of the vertices
- * @param is_dag tests if the graph is a dag (optional)
+ * @return the number of sources sampled
  */
-int topological_order(
-    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
-    mbglIndex *topo_order, int *is_dag)
+template <class Graph, class EdgeMap, class ShortestPaths>
+static mbglIndex sampled_betweenness_centrality(const Graph& g,
+    double epsilon, double delta, mbglIndex cap, unsigned int seed,
+    double *centrality, EdgeMap ecentrality, ShortestPaths shortest_paths)
 {
-    using namespace yasmic;
     using namespace boost;
 
-    typedef simple_csr_matrix<mbglIndex,double> crs_graph;
-    crs_graph g(nverts, nverts, ia[nverts], ia, ja, NULL);
+    mbglIndex n = num_vertices(g);
+    double scale = (double)(n-2); // the largest dependency on a source
 
-    if (is_dag) {
-        *is_dag = 1;
-    }
+    mbglIndex batch = (std::min)(cap, (std::max)((mbglIndex)64, cap/32));
 
-    if (topo_order == NULL)
-    {
-        return (-1);
-    }
-    else
-    {
-        typedef reverse_iterator<mbglIndex*>
-            reverse_iter;
+    std::vector<double> squares(n, 0.0);
+    std::vector<mbglIndex> sources;
+    sources.reserve(cap);
 
-        // note for the future, boost's reverse iterator is wild in that
-        // it actually dereferences the PRIOR element, so the correct
-        // range of a boost reverse itertor is the same as the original
-        // iterator.  Consequently, the last element is actual topo_order +
-        // nverts because the previous element (what * returns) is the
-        // correct element.
-        reverse_iter output(topo_order + (nverts));
+    boost::mt19937 gen(seed);
+    boost::uniform_int<mbglIndex> pick_vertex(0, n-1);
 
-        try {
-            topological_sort(g, output);
-        } catch (not_a_dag) {
-            if (is_dag) {
-                *is_dag = 0;
+    for (int r=1; ; ++r) {
+        mbglIndex start = (mbglIndex)sources.size();
+        while ((mbglIndex)sources.size() < start+batch) {
+            sources.push_back(pick_vertex(gen));
+        }
+        parallel_brandes_accumulate_sources(g, sources.begin()+start,
+            (std::ptrdiff_t)batch,
+            make_iterator_property_map(centrality, get(vertex_index, g)),
+            make_iterator_property_map(&squares[0], get(vertex_index, g)),
+            ecentrality, get(vertex_index, g), get(edge_index, g),
+            shortest_paths);
+
+        mbglIndex k = (mbglIndex)sources.size();
+        if (k >= cap) { break; }
+        if (epsilon > 0 && k > 1) {
+            // check the empirical Bernstein bound on every vertex with
+            // probability delta/2^(r+1) of failure in this round
+            double L = log(3.0*(double)n*pow(2.0,(double)(r+1))/delta);
+            double maxerr = 0.0;
+            for (mbglIndex v=0; v<n; ++v) {
+                double mean = centrality[v]/((double)k*scale);
+                double var = (squares[v]/(scale*scale) - (double)k*mean*mean)
+                                /(double)(k-1);
+                if (var < 0) { var = 0; }
+                double err = sqrt(2.0*var*L/(double)k)
+                                + 7.0*L/(3.0*(double)(k-1));
+                if (err > maxerr) { maxerr = err; }
             }
+            if (maxerr <= epsilon) { break; }
         }
+        batch = (std::min)(k, cap-k);
     }
 
-    return (0);
-}
-
-template <typename Graph,
-        typename MateMap,
-        typename VertexIndexMap>
-bool matching_help(const Graph& g, MateMap mate, VertexIndexMap vm,
-                   int initial_matching, int augmenting_path, int verify)
-{
-    using namespace boost;
-    if (initial_matching == 1)
-    {
-        if (augmenting_path == 1)
-            if (verify == 1)
-                return matching<Graph,MateMap,VertexIndexMap,
-                        no_augmenting_path_finder,
-                        empty_matching,
-                        no_matching_verifier>
-                        (g, mate, vm);
-            else
-                return matching<Graph,MateMap,VertexIndexMap,
-                        no_augmenting_path_finder,
-                        empty_matching,
-                        maximum_cardinality_matching_verifier>
-                        (g, mate, vm);
-        else
-            if (verify == 1)
-                return matching<Graph,MateMap,VertexIndexMap,
-                        edmonds_augmenting_path_finder,
-                        empty_matching,
-                        no_matching_verifier>
-                        (g, mate, vm);
-            else
-                return matching<Graph,MateMap,VertexIndexMap,
-                        edmonds_augmenting_path_finder,
-                        empty_matching,
-                        maximum_cardinality_matching_verifier>
-                        (g, mate, vm);
-    }
-    else if (initial_matching == 2)
-    {
-        if (augmenting_path == 1)
-            if (verify == 1)
-                return matching<Graph,MateMap,VertexIndexMap,
-                        no_augmenting_path_finder,
-                        greedy_matching,
-                        no_matching_verifier>
-                        (g, mate, vm);
-            else
-                return matching<Graph,MateMap,VertexIndexMap,
-                        no_augmenting_path_finder,
-                        greedy_matching,
-                        maximum_cardinality_matching_verifier>
-                        (g, mate, vm);
-        else
-            if (verify == 1)
-                return matching<Graph,MateMap,VertexIndexMap,
-                        edmonds_augmenting_path_finder,
-                        greedy_matching,
-                        no_matching_verifier>
-                        (g, mate, vm);
-            else
-                return matching<Graph,MateMap,VertexIndexMap,
-                        edmonds_augmenting_path_finder,
-                        greedy_matching,
-                        maximum_cardinality_matching_verifier>
-                        (g, mate, vm);
-    }
-    else
-    {
-        if (augmenting_path == 1)
-            if (verify == 1)
-                return matching<Graph,MateMap,VertexIndexMap,
-                        no_augmenting_path_finder,
-                        extra_greedy_matching,
-                        no_matching_verifier>
-                        (g, mate, vm);
-            else
-                return matching<Graph,MateMap,VertexIndexMap,
-                        no_augmenting_path_finder,
-                        extra_greedy_matching,
-                        maximum_cardinality_matching_verifier>
-                        (g, mate, vm);
-        else
-            if (verify == 1)
-                return matching<Graph,MateMap,VertexIndexMap,
-                        edmonds_augmenting_path_finder,
-                        extra_greedy_matching,
-                        no_matching_verifier>
-                        (g, mate, vm);
-            else
-                return matching<Graph,MateMap,VertexIndexMap,
-                        edmonds_augmenting_path_finder,
-                        extra_greedy_matching,
-                        maximum_cardinality_matching_verifier>
-                        (g, mate, vm);
-    }
+    return (mbglIndex)sources.size();
 }
 
-/** Wrap a boost graph library call to matching.
- *
- * A matching is a subset of edges with no common vertices in an undirected
- * graph.
- *
- * A maximum cardinality matching has the largest number of edges over all
- * possible matchings.
+/** Estimate the betweenness centrality of all vertices and edges
  *
- * The graph must be undirected.
+ * This function samples sources uniformly at random and scales their
+ * dependencies (Brandes and Pich, 2007) so that the estimate is on the
+ * same scale as betweenness_centrality.  With epsilon > 0, the 
+ * estimate of each vertex is within epsilon*n*(n-2) of the exact 
+ * betweenness with probability at least 1-delta, unless max_samples
+ * stops the sampling before the bound is met.  The sampling stops
+ * early when an empirical Bernstein bound shows the estimate is 
+ * accurate enough.  With epsilon = 0, the function uses exactly 
+ * max_samples sources.  If the sample would have at least nverts 
+ * sources, the function computes the exact betweenness instead.
  *
  * @param nverts the number of vertices in the graph
  * @param ja the connectivity for each vertex
  * @param ia the row connectivity points into ja
- * @param mate an array of size nverts which stores the matching vertex index
- *  or null vertex if there is no match
- * @param initial_matching indicates the initial matching used in the algorithm
- *  1: no_matching
- *  2: greedy_matching
- *  3: extra_greedy_matching
- * @param augmenting_path indicates the algorithm used to find augmenting paths
- *  1: no_augmenting_path_finder
- *  2: edmonds_augmenting_path_finder
- * @param verify indicates if we verify the algorithm ouput
- *  1: no_matching_verifier
- *  2: maximum_cardinality_matching_verifier
- * @param verified the output of the verification algorithm (if run), or
- *  false otherwise
- * @param null_vertex the special index to indicate an unmatched vertex
+ * @param weight the weight of each edge, or NULL for an unweighted graph
+ * @param epsilon the accuracy of the estimate relative to n*(n-2), or 0
+ *   to use a fixed number of samples
+ * @param delta the probability of failure, 0 < delta < 1
+ * @param max_samples the largest number of sources to sample, or 0 for
+ *   no limit beyond the bound from epsilon and delta
+ * @param seed the random seed
+ * @param centrality the vertex centrality, length nverts
+ * @param ecentrality the edge centrality (optional), length nnz
+ * @param nsamples the number of sources used (optional)
  * @return an error code if possible
  *   0: indicates success
- *  -1: indicates a parameter error with initial_matching, augmenting_path, or verify
+ *  -1: indicates an invalid accuracy or sample size
  */
-int maximum_cardinality_matching(
-    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
-    mbglIndex* mate, int initial_matching, int augmenting_path, int verify,
-    int *verified, mbglIndex *null_vertex)
+int approximate_betweenness_centrality(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, double *weight, /* connectivity params */
+    double epsilon, double delta, mbglIndex max_samples, unsigned int seed,
+    double *centrality, double *ecentrality, mbglIndex *nsamples)
 {
     using namespace yasmic;
     using namespace boost;
 
-    typedef simple_csr_matrix<mbglIndex,double> crs_graph;
-    crs_graph g(nverts, nverts, ia[nverts], ia, ja, NULL);
+    if (epsilon < 0 || (epsilon == 0 && max_samples == 0)) { return (-1); }
+    if (epsilon > 0 && (delta <= 0 || delta >= 1)) { return (-1); }
 
-    if (initial_matching < 1 || initial_matching > 3 ||
-        augmenting_path < 1 || augmenting_path > 2 ||
-        verify < 1 || verify > 2)
-    {
-        return (-1);
+    mbglIndex cap = max_samples;
+    if (epsilon > 0 && nverts > 0) {
+        double hoeffding = ceil(log(4.0*(double)nverts/delta)/(2.0*epsilon*epsilon));
+        if (cap == 0 || hoeffding < (double)cap) { cap = (mbglIndex)hoeffding; }
+    }
+    if (nverts < 3 || cap >= nverts) {
+        if (nsamples) { *nsamples = nverts; }
+        return betweenness_centrality(nverts, ja, ia, weight,
+            centrality, ecentrality);
     }
 
-    bool max_matching =
-        matching_help(g,mate,get(vertex_index,g),
-            initial_matching,augmenting_path,verify);
+    typedef simple_csr_matrix<mbglIndex,double> crs_graph;
+    crs_graph g(nverts, nverts, ia[nverts], ia, ja, weight);
 
-    if (verified) {
-        *verified = 0;
-        if (verify > 1) { *verified = max_matching; }
+    for (mbglIndex i=0; i<nverts; ++i) { centrality[i] = 0.0; }
+    if (ecentrality) {
+        for (mbglIndex i=0; i<ia[nverts]; ++i) { ecentrality[i] = 0.0; }
     }
 
-    if (null_vertex) {
-        *null_vertex = graph_traits<crs_graph>::null_vertex();
+    mbglIndex k;
+    if (weight) {
+        brandes_dijkstra_shortest_paths<
+            property_map<crs_graph, edge_weight_t>::const_type>
+                dijkstra(get(edge_weight, g));
+        if (ecentrality) {
+            k = sampled_betweenness_centrality(g, epsilon, delta, cap, seed,
+                centrality,
+                make_iterator_property_map(ecentrality, get(edge_index, g)),
+                dijkstra);
+        } else {
+            k = sampled_betweenness_centrality(g, epsilon, delta, cap, seed,
+                centrality, dummy_property_map(), dijkstra);
+        }
+    } else {
+        brandes_unweighted_shortest_paths bfs;
+        if (ecentrality) {
+            k = sampled_betweenness_centrality(g, epsilon, delta, cap, seed,
+                centrality,
+                make_iterator_property_map(ecentrality, get(edge_index, g)),
+                bfs);
+        } else {
+            k = sampled_betweenness_centrality(g, epsilon, delta, cap, seed,
+                centrality, dummy_property_map(), bfs);
+        }
     }
 
-    return (0);
-}
+    // scale the sample so it estimates the sum over all sources
+    double factor = (double)nverts/(double)k;
+    for (mbglIndex i=0; i<nverts; ++i) { centrality[i] *= factor; }
+    if (ecentrality) {
+        for (mbglIndex i=0; i<ia[nverts]; ++i) { ecentrality[i] *= factor; }
+    }
+    if (nsamples) { *nsamples = k; }
 
-template <typename Graph, typename MateMap, typename VertexIndexMap>
-bool verify_matching_help(const Graph& g, MateMap mate, VertexIndexMap vm)
-{
-    return boost::maximum_cardinality_matching_verifier<
-                    Graph,MateMap,VertexIndexMap>::verify_matching(g,mate,vm);
+    return (0);
 }
 
-/*
- * mate = nverts if unmatched
+/** The workspace for one thread of the closeness centrality searches.
+ *
+ * The distances are reset after each source, so each search only costs
+ * the size of the region it visits.
  */
-int test_maximum_cardinality_matching(
-    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
-    mbglIndex* mate, int *verified)
+struct closeness_workspace
 {
-    using namespace yasmic;
-    using namespace boost;
+    typedef std::pair<double,mbglIndex> entry;
 
-    typedef simple_csr_matrix<mbglIndex,double> crs_graph;
-    crs_graph g(nverts, nverts, ia[nverts], ia, ja, NULL);
+    closeness_workspace(mbglIndex nverts)
+        : dist(nverts, std::numeric_limits<double>::infinity())
+    {}
 
-    // set the null_vertex to the true null
-    mbglIndex true_null = graph_traits<crs_graph>::null_vertex();
-    for (mbglIndex v=0;v<num_vertices(g);++v) {
-        if (mate[v] == nverts) { mate[v] = true_null; }
-    }
+    std::vector<double> dist;
+    std::vector<mbglIndex> touched;
+    std::vector<mbglIndex> bfs;
+    std::priority_queue<entry, std::vector<entry>, std::greater<entry> > heap;
+};
 
-    bool max_matching = verify_matching_help(g, mate, get(vertex_index,g));
-    if (verified) { *verified = 0; }
-    if (max_matching && verified) { *verified = 1; }
+/** The closeness or harmonic centrality after r vertices are reached
+ * with total distance f (closeness) or total inverse distance h 
+ * (harmonic).  The closeness is the Wasserman and Faust variant, which 
+ * is meaningful on disconnected graphs.
+ */
+static double closeness_score(mbglIndex nverts, int harmonic,
+    double r, double f, double h)
+{
+    if (harmonic) { return h; }
+    if (f <= 0) { return 0.0; }
+    return (r-1.0)*(r-1.0)/((double)(nverts-1)*f);
+}
 
-    return (0);
+/** An upper bound on the centrality of a source when every vertex it
+ * has not reached is at least d away.  This is the level bound from
+ * Bergamini et al., "Computing top-k closeness centrality faster in 
+ * unweighted graphs," ALENEX 2016, adapted to graphs that are not 
+ * strongly connected by allowing any number of the remaining vertices to
+ * be unreachable.  The closeness is a convex function of that number, so
+ * the bound is the larger of the two extremes.
+ */
+static double closeness_upper_bound(mbglIndex nverts, int harmonic,
+    double r, double f, double h, double d)
+{
+    double rest = (double)nverts - r;
+    if (harmonic) { return h + rest/d; }
+    return (std::max)(closeness_score(nverts, harmonic, r, f, h),
+        closeness_score(nverts, harmonic, r+rest, f+d*rest, h));
 }
 
-/** Compute the core_numbers of a graph
+/** Compute the closeness or harmonic centrality of one source
  *
- * For an undirected graph, this function computes the core number of each
- * vertex.  The core number is the minimum number such that removing all
- * vertices of degree <= cn[k] removes vertex k.  For a directed graph
- * we compute the in-degree core number.
+ * The search is a breadth first search when weight is NULL and
+ * Dijkstra's algorithm otherwise.  Each time the search moves to a 
+ * farther distance, it checks an upper bound on the centrality and
+ * stops if the bound is below threshold.
  *
- * @param nverts the number of vertices in the graph
- * @param ja the connectivity for each vertex
- * @param ia the row connectivity points into ja
- * @param cn an array of core numbers, length nverts
- * @param rt an array of removal times, length nverts
- * @return an error code if possible
+ * @return the centrality, or -1 if the search stopped early
  */
-int core_numbers(
-    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
-    mbglDegreeType *cn, int *rt)
+static double source_closeness(mbglIndex s,
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, double *weight,
+    int harmonic, double *threshold, closeness_workspace& work)
 {
-    // History
-    //
-    // 30 July 2007
-    // added removal time visitor
-    // changed to mbglDegreeType
-    using namespace yasmic;
-    using namespace boost;
-
-    if (!cn || !rt) { return (-1); }
-
+    std::vector<double>& dist = work.dist;
+    double r = 0.0, f = 0.0, h = 0.0, last = 0.0;
+    bool pruned = false;
+
+    dist[s] = 0.0;
+    work.touched.push_back(s);
+    if (weight) {
+        work.heap.push(closeness_workspace::entry(0.0, s));
+    } else {
+        work.bfs.push_back(s);
+    }
 
-    typedef simple_csr_matrix<mbglIndex,double> crs_graph;
-    crs_graph g(nverts, nverts, ia[nverts], ia, ja, NULL);
+    size_t qhead = 0;
+    while (!pruned) {
+        mbglIndex u;
+        double du;
+        if (weight) {
+            if (work.heap.empty()) { break; }
+            du = work.heap.top().first;
+            u = work.heap.top().second;
+            work.heap.pop();
+            if (du > dist[u]) { continue; }
+        } else {
+            if (qhead >= work.bfs.size()) { break; }
+            u = work.bfs[qhead++];
+            du = dist[u];
+        }
 
-    int time = 0;
+        if (du > last && threshold) {
+            // every vertex we haven't finished is at least du away
+            double t;
+            #pragma omp atomic read
+            t = *threshold;
+            if (closeness_upper_bound(nverts, harmonic, r, f, h, du) < t) {
+                pruned = true;
+                break;
+            }
+        }
+        last = du;
+
+        r += 1.0;
+        f += du;
+        if (du > 0) { h += 1.0/du; }
+
+        for (mbglIndex ri=ia[u]; ri<ia[u+1]; ++ri) {
+            mbglIndex w = ja[ri];
+            double dw = du + (weight ? weight[ri] : 1.0);
+            if (dw < dist[w]) {
+                if (dist[w] == std::numeric_limits<double>::infinity()) {
+                    work.touched.push_back(w);
+                    if (!weight) { work.bfs.push_back(w); }
+                }
+                dist[w] = dw;
+                if (weight) {
+                    work.heap.push(closeness_workspace::entry(dw, w));
+                }
+            }
+        }
+    }
 
-    core_numbers(g, make_iterator_property_map(cn, get(vertex_index,g)),
-        make_core_numbers_visitor(stamp_times(rt, time, on_examine_vertex())));
+    for (size_t i=0; i<work.touched.size(); ++i) {
+        dist[work.touched[i]] = std::numeric_limits<double>::infinity();
+    }
+    work.touched.clear();
+    work.bfs.clear();
+    while (!work.heap.empty()) { work.heap.pop(); }
 
-    return (0);
+    if (pruned) { return -1.0; }
+    return closeness_score(nverts, harmonic, r, f, h);
 }
 
-/** Compute the weighted core numbers of a graph
+/** Compute the closeness or harmonic centrality of all vertices
  *
- * For an undirected graph, this function computes the core number of each
- * vertex.  The core number is the minimum number such that removing all
- * vertices of weighted in-degree <= cn[k] removes vertex k.  For a
- * directed graph we compute the weighted in-degree core number.
+ * The closeness centrality of v is (r-1)^2/((n-1)*f) where r is the 
+ * number of vertices reachable from v (including v) and f is the sum of
+ * the distances from v to them.  The harmonic centrality of v is the 
+ * sum of 1/d(v,w) over all w reachable from v.  The sources are
+ * distributed among OpenMP threads and no distance matrix is formed.
  *
  * @param nverts the number of vertices in the graph
  * @param ja the connectivity for each vertex
  * @param ia the row connectivity points into ja
- * @param cn an array of core numbers, length nverts
- * @param rt an array of removal times, length nverts
+ * @param weight the positive weight of each edge, or NULL for an 
+ *   unweighted graph
+ * @param harmonic 0 for closeness centrality, 1 for harmonic centrality
+ * @param centrality the centrality of each vertex, length nverts
  * @return an error code if possible
  */
-int weighted_core_numbers(
+int closeness_centrality(
     mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, double *weight, /* connectivity params */
-    double *cn, int *rt)
+    int harmonic, double *centrality)
 {
-    // History
-    //
-    // 30 July 2007
+    #pragma omp parallel
+    {
+        closeness_workspace work(nverts);
+        #pragma omp for schedule(dynamic, 16)
+        for (ptrdiff_t i=0; i<(ptrdiff_t)nverts; ++i) {
+            centrality[i] = source_closeness((mbglIndex)i, nverts, ja, ia,
+                weight, harmonic, NULL, work);
+        }
+    }
+
+    return (0);
+}
+
+/** Order vertices by decreasing degree. */
+struct closeness_degree_order
+{
+    const mbglIndex *ia;
+    bool operator() (mbglIndex u, mbglIndex v) const {
+        mbglIndex du = ia[u+1]-ia[u], dv = ia[v+1]-ia[v];
+        return du > dv || (du == dv && u < v);
+    }
+};
+
+/** Order (score, vertex) pairs by decreasing score. */
+struct closeness_score_order
+{
+    bool operator() (const std::pair<double,mbglIndex>& a,
+                     const std::pair<double,mbglIndex>& b) const {
+        return a.first > b.first || (a.first == b.first && a.second < b.second);
+    }
+};
+
+/** Compute the k vertices with the largest closeness or harmonic
+ * centrality
+ *
+ * The sources are searched in order of decreasing degree.  Once there 
+ * are k exact values, each search stops as soon as an upper bound on 
+ * the centrality of its source falls below the k-th largest value, so 
+ * only the most central vertices are computed exactly.  The centrality
+ * definitions are the same as in closeness_centrality.
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex
+ * @param ia the row connectivity points into ja
+ * @param weight the positive weight of each edge, or NULL for an 
+ *   unweighted graph
+ * @param harmonic 0 for closeness centrality, 1 for harmonic centrality
+ * @param k the number of vertices to find
+ * @param topk the vertices with the largest centrality in decreasing 
+ *   order, length min(k,nverts)
+ * @param scores the centrality of each vertex in topk
+ * @param nsearched the number of searches that were not pruned 
+ *   (optional)
+ * @return an error code if possible
+ *   0: indicates success
+ *  -1: indicates k = 0
+ */
+int top_k_closeness_centrality(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, double *weight, /* connectivity params */
+    int harmonic, mbglIndex k, mbglIndex *topk, double *scores,
+    mbglIndex *nsearched)
+{
+    typedef std::pair<double,mbglIndex> scored_vertex;
+
+    if (k == 0) { return (-1); }
+    if (k > nverts) { k = nverts; }
+
+    std::vector<mbglIndex> order(nverts);
+    for (mbglIndex i=0; i<nverts; ++i) { order[i] = i; }
+    closeness_degree_order by_degree = {ia};
+    std::sort(order.begin(), order.end(), by_degree);
+
+    // best is a min-heap on the scores of the k best vertices so far
+    std::vector<scored_vertex> best;
+    closeness_score_order by_score;
+    double threshold = -1.0;
+    mbglIndex searched = 0;
+
+    #pragma omp parallel
+    {
+        closeness_workspace work(nverts);
+        #pragma omp for schedule(dynamic, 1) reduction(+:searched)
+        for (ptrdiff_t i=0; i<(ptrdiff_t)nverts; ++i) {
+            mbglIndex s = order[i];
+            double c = source_closeness(s, nverts, ja, ia, weight, harmonic,
+                &threshold, work);
+            if (c < 0) { continue; }
+            ++searched;
+            #pragma omp critical
+            {
+                scored_vertex sv(c, s);
+                if ((mbglIndex)best.size() < k) {
+                    best.push_back(sv);
+                    std::push_heap(best.begin(), best.end(), by_score);
+                } else if (by_score(sv, best.front())) {
+                    std::pop_heap(best.begin(), best.end(), by_score);
+                    best.back() = sv;
+                    std::push_heap(best.begin(), best.end(), by_score);
+                }
+                if ((mbglIndex)best.size() == k) {
+                    #pragma omp atomic write
+                    threshold = best.front().first;
+                }
+            }
+        }
+    }
+
+    std::sort_heap(best.begin(), best.end(), by_score);
+    for (mbglIndex i=0; i<k; ++i) {
+        topk[i] = best[i].second;
+        scores[i] = best[i].first;
+    }
+    if (nsearched) { *nsearched = searched; }
+
+    return (0);
+}
+
+/** Compute the PageRank vector of a graph
+ *
+ * The PageRank vector x solves x = alpha*P'*x + (1-alpha)*v where P is 
+ * the random walk matrix of the graph.  A random walk at a dangling 
+ * vertex, with no out-edges, jumps according to v.  This function uses
+ * the power method with a pull-based product on the transpose of the 
+ * graph.  Each iteration is a single fused pass that computes the new 
+ * vector, the L1 residual, the dangling mass, and the scaled vector for
+ * the next product.  The passes are split among OpenMP threads.
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex
+ * @param ia the row connectivity points into ja
+ * @param weight the non-negative weight of each edge, or NULL for an 
+ *   unweighted graph
+ * @param alpha the probability of following an edge, 0 <= alpha < 1
+ * @param v the teleportation distribution (optional), length nverts.
+ *   If v is NULL, it is uniform.  Otherwise it is normalized to sum 1.
+ * @param tol the tolerance on the L1 norm of the change in x
+ * @param maxiter the largest number of iterations
+ * @param x the PageRank vector, length nverts
+ * @param niter the number of iterations (optional)
+ * @param residual the L1 norm of the last change in x (optional)
+ * @return an error code if possible
+ *   0: indicates success
+ *  -1: indicates an invalid parameter or a negative weight
+ */
+int pagerank(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, double *weight, /* connectivity params */
+    double alpha, double *v, double tol, mbglIndex maxiter,
+    double *x, mbglIndex *niter, double *residual)
+{
+    if (alpha < 0 || alpha >= 1) { return (-1); }
+    if (nverts == 0) {
+        if (niter) { *niter = 0; }
+        if (residual) { *residual = 0.0; }
+        return (0);
+    }
+
+    mbglIndex nz = ia[nverts];
+
+    // normalize the teleportation vector
+    std::vector<double> tele(nverts, 1.0/(double)nverts);
+    if (v) {
+        double vsum = 0.0;
+        for (mbglIndex i=0; i<nverts; ++i) {
+            if (v[i] < 0) { return (-1); }
+            vsum += v[i];
+        }
+        if (vsum <= 0) { return (-1); }
+        for (mbglIndex i=0; i<nverts; ++i) { tele[i] = v[i]/vsum; }
+    }
+
+    // the inverse out-degree or out-weight of each vertex, 0 if dangling
+    std::vector<double> inv(nverts, 0.0);
+    for (mbglIndex i=0; i<nverts; ++i) {
+        double out = 0.0;
+        if (weight) {
+            for (mbglIndex ri=ia[i]; ri<ia[i+1]; ++ri) {
+                if (weight[ri] < 0) { return (-1); }
+                out += weight[ri];
+            }
+        } else {
+            out = (double)(ia[i+1]-ia[i]);
+        }
+        if (out > 0) { inv[i] = 1.0/out; }
+    }
+
+    // build the transpose so each vertex pulls from its in-neighbors
+    std::vector<mbglIndex> tia(nverts+1, 0), tja(nz);
+    std::vector<double> tval(weight ? nz : 0);
+    for (mbglIndex ri=0; ri<nz; ++ri) { ++tia[ja[ri]+1]; }
+    for (mbglIndex i=0; i<nverts; ++i) { tia[i+1] += tia[i]; }
+    {
+        std::vector<mbglIndex> next(tia.begin(), tia.end()-1);
+        for (mbglIndex i=0; i<nverts; ++i) {
+            for (mbglIndex ri=ia[i]; ri<ia[i+1]; ++ri) {
+                mbglIndex k = next[ja[ri]]++;
+                tja[k] = i;
+                if (weight) { tval[k] = weight[ri]; }
+            }
+        }
+    }
+
+    // y is the current vector scaled by the inverse out-degree
+    std::vector<double> y(nverts), ynext(nverts);
+    double dangling = 0.0;
+    for (mbglIndex i=0; i<nverts; ++i) {
+        x[i] = tele[i];
+        y[i] = x[i]*inv[i];
+        if (inv[i] == 0) { dangling += x[i]; }
+    }
+
+    const mbglIndex *tiap = &tia[0], *tjap = nz > 0 ? &tja[0] : NULL;
+    const double *tvalp = (weight && nz > 0) ? &tval[0] : NULL;
+    mbglIndex iter = 0;
+    double delta = 2.0;
+
+    while (iter < maxiter && delta >= tol) {
+        const double *yp = &y[0];
+        double *ynp = &ynext[0];
+        double c = alpha*dangling + (1.0-alpha);
+        double diff = 0.0, dnext = 0.0;
+
+        #pragma omp parallel for schedule(guided) reduction(+:diff,dnext)
+        for (ptrdiff_t i=0; i<(ptrdiff_t)nverts; ++i) {
+            double sum = 0.0;
+            mbglIndex start = tiap[i], end = tiap[i+1];
+            if (tvalp) {
+#if defined(_OPENMP) && _OPENMP >= 201307
+                #pragma omp simd reduction(+:sum)
+#endif
+                for (mbglIndex k=start; k<end; ++k) {
+                    sum += tvalp[k]*yp[tjap[k]];
+                }
+            } else {
+#if defined(_OPENMP) && _OPENMP >= 201307
+                #pragma omp simd reduction(+:sum)
+#endif
+                for (mbglIndex k=start; k<end; ++k) {
+                    sum += yp[tjap[k]];
+                }
+            }
+            double xi = alpha*sum + c*tele[i];
+            diff += fabs(xi - x[i]);
+            x[i] = xi;
+            ynp[i] = xi*inv[i];
+            if (inv[i] == 0) { dnext += xi; }
+        }
+
+        y.swap(ynext);
+        dangling = dnext;
+        delta = diff;
+        ++iter;
+    }
+
+    if (niter) { *niter = iter; }
+    if (residual) { *residual = delta; }
+
+    return (0);
+}
+
+/** Order the entries of a local PageRank vector by x(u)/deg(u) for a
+ * sweep cut. */
+struct ppr_sweep_order
+{
+    const double *deg;
+    const double *pv;
+    bool operator() (mbglIndex a, mbglIndex b) const {
+        // compare pv[a]/deg[a] > pv[b]/deg[b] without dividing
+        return pv[a]*deg[b] > pv[b]*deg[a];
+    }
+};
+
+/** Compute a local personalized PageRank vector with push steps
+ *
+ * This is the push algorithm of Andersen, Chung, and Lang, "Local graph
+ * partitioning using PageRank vectors," FOCS 2006, without the lazy 
+ * walk.  The residual and the solution are stored in hash maps, so the 
+ * function only touches the vertices it pushes.  A push at u moves 
+ * (1-alpha)*r(u) into x(u) and spreads alpha*r(u) evenly over the 
+ * neighbors of u.  The pushes stop when r(u) < eps*deg(u) for all u.  
+ * The number of pushes is at most 1/(eps*(1-alpha)), so x has at most
+ * nseeds + 1/(eps*(1-alpha)) non-zeros.
+ *
+ * With sweep = 1, the entries of x are sorted by x(u)/deg(u) in 
+ * decreasing order and the function finds the prefix of that order with
+ * the smallest conductance.  The graph must be undirected.
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex
+ * @param ia the row connectivity points into ja
+ * @param alpha the probability of following an edge, 0 <= alpha < 1, the
+ *   same as in pagerank
+ * @param nseeds the number of seed vertices
+ * @param seeds the seed vertices, the teleportation vector is uniform
+ *   over the seeds
+ * @param eps the tolerance on the residual relative to the degree
+ * @param maxnz the length of the pi and pv arrays
+ * @param pi the vertices with a non-zero value in x
+ * @param pv the values of x for the vertices in pi
+ * @param nnz the number of entries in pi and pv
+ * @param sweep 1 to sort pi and pv and find the best sweep cut
+ * @param bestsize the number of vertices in the best sweep cut, it is
+ *   the first bestsize vertices of pi (optional)
+ * @param bestcond the conductance of the best sweep cut (optional)
+ * @param npushes the number of push steps (optional)
+ * @return an error code if possible
+ *   0: indicates success
+ *  -1: indicates an invalid parameter or seed
+ *  -2: indicates that x has more than maxnz non-zeros
+ */
+int local_pagerank(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
+    double alpha, mbglIndex nseeds, mbglIndex *seeds, double eps,
+    mbglIndex maxnz, mbglIndex *pi, double *pv, mbglIndex *nnz,
+    int sweep, mbglIndex *bestsize, double *bestcond, mbglIndex *npushes)
+{
+    typedef boost::unordered_map<mbglIndex,double> sparse_vector;
+
+    if (alpha < 0 || alpha >= 1 || eps <= 0 || nseeds == 0) { return (-1); }
+    for (mbglIndex i=0; i<nseeds; ++i) {
+        if (seeds[i] >= nverts) { return (-1); }
+    }
+
+    sparse_vector x, r;
+    std::vector<mbglIndex> queue;
+    size_t qhead = 0;
+    mbglIndex pushes = 0;
+
+    for (mbglIndex i=0; i<nseeds; ++i) {
+        r[seeds[i]] += 1.0/(double)nseeds;
+    }
+    for (sparse_vector::iterator ri=r.begin(); ri!=r.end(); ++ri) {
+        queue.push_back(ri->first);
+    }
+
+    while (qhead < queue.size()) {
+        mbglIndex u = queue[qhead++];
+        double& ru = r[u];
+        mbglIndex du = ia[u+1]-ia[u];
+        if (ru < eps*(double)du) { continue; }
+        double mass = ru;
+        ru = 0.0;
+        ++pushes;
+        if (du == 0) {
+            // there is nowhere to go, so all the mass stays at u
+            x[u] += mass;
+            continue;
+        }
+        x[u] += (1.0-alpha)*mass;
+        double share = alpha*mass/(double)du;
+        for (mbglIndex ri=ia[u]; ri<ia[u+1]; ++ri) {
+            mbglIndex v = ja[ri];
+            double thresh = eps*(double)(ia[v+1]-ia[v]);
+            double& rv = r[v];
+            // only queue v when its residual crosses the threshold
+            if (rv < thresh && rv + share >= thresh) { queue.push_back(v); }
+            rv += share;
+        }
+        // reclaim the queue so its length is the number of queued vertices
+        if (qhead > 1024 && 2*qhead > queue.size()) {
+            queue.erase(queue.begin(), queue.begin()+qhead);
+            qhead = 0;
+        }
+    }
+
+    if ((mbglIndex)x.size() > maxnz) { return (-2); }
+
+    mbglIndex k = 0;
+    for (sparse_vector::iterator xi=x.begin(); xi!=x.end(); ++xi, ++k) {
+        pi[k] = xi->first;
+        pv[k] = xi->second;
+    }
+    *nnz = k;
+    if (npushes) { *npushes = pushes; }
+
+    if (sweep) {
+        // sort the entries by x(u)/deg(u)
+        std::vector<mbglIndex> perm(k), verts(pi, pi+k);
+        std::vector<double> values(pv, pv+k), degs(k);
+        for (mbglIndex i=0; i<k; ++i) {
+            perm[i] = i;
+            degs[i] = (double)(ia[verts[i]+1]-ia[verts[i]]);
+        }
+        ppr_sweep_order order = {&degs[0], &values[0]};
+        std::stable_sort(perm.begin(), perm.end(), order);
+
+        boost::unordered_map<mbglIndex,mbglIndex> rank;
+        for (mbglIndex i=0; i<k; ++i) {
+            pi[i] = verts[perm[i]];
+            pv[i] = values[perm[i]];
+            rank[pi[i]] = i;
+        }
+
+        double total = (double)ia[nverts], vol = 0.0, cut = 0.0;
+        double best = std::numeric_limits<double>::infinity();
+        mbglIndex bsize = 0;
+        for (mbglIndex i=0; i<k; ++i) {
+            mbglIndex u = pi[i];
+            mbglIndex inside = 0;
+            for (mbglIndex ri=ia[u]; ri<ia[u+1]; ++ri) {
+                boost::unordered_map<mbglIndex,mbglIndex>::iterator
+                    vi = rank.find(ja[ri]);
+                if (vi != rank.end() && vi->second < i) { ++inside; }
+            }
+            vol += (double)(ia[u+1]-ia[u]);
+            cut += (double)(ia[u+1]-ia[u]) - 2.0*(double)inside;
+            double denom = (std::min)(vol, total-vol);
+            if (denom > 0 && cut/denom < best) {
+                best = cut/denom;
+                bsize = i+1;
+            }
+        }
+        if (bestsize) { *bestsize = bsize; }
+        if (bestcond) { *bestcond = best; }
+    }
+
+    return (0);
+}
+
+/**
+ * Test for a topological order or topological sort of a graph.
+ *
+ * This function will also test if the graph is a dag.  If the
+ * rev_order parameter is null, then the actual topological order
+ * is ignored and the function just tests for a dag.
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex
+ * @param ia the row connectivity points into ja
+ * @param topo_order a topological order of the vertices
+ * @param is_dag tests if the graph is a dag (optional)
+ */
+int topological_order(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
+    mbglIndex *topo_order, int *is_dag)
+{
+    using namespace yasmic;
+    using namespace boost;
+
+    typedef simple_csr_matrix<mbglIndex,double> crs_graph;
+    crs_graph g(nverts, nverts, ia[nverts], ia, ja, NULL);
+
+    if (is_dag) {
+        *is_dag = 1;
+    }
+
+    if (topo_order == NULL)
+    {
+        return (-1);
+    }
+    else
+    {
+        typedef reverse_iterator<mbglIndex*>
+            reverse_iter;
+
+        // note for the future, boost's reverse iterator is wild in that
+        // it actually dereferences the PRIOR element, so the correct
+        // range of a boost reverse itertor is the same as the original
+        // iterator.  Consequently, the last element is actual topo_order +
+        // nverts because the previous element (what * returns) is the
+        // correct element.
+        reverse_iter output(topo_order + (nverts));
+
+        try {
+            topological_sort(g, output);
+        } catch (not_a_dag) {
+            if (is_dag) {
+                *is_dag = 0;
+            }
+        }
+    }
+
+    return (0);
+}
+
+/** Compute an initial matching with the Karp-Sipser heuristic.
+ *
+ * A vertex with exactly one unmatched neighbor is always matched to that
+ * neighbor, which never decreases the size of the maximum matching that
+ * contains the current one.  When there are no such vertices, the 
+ * heuristic picks an unmatched vertex in a random order and matches it
+ * to the unmatched neighbor with the smallest remaining degree.  The
+ * random order uses a fixed seed so the output is repeatable.  
+ *
+ * The vertices of the graph must be the indices 0 to num_vertices(g)-1.
+ */
+template <typename Graph, typename MateMap>
+struct karp_sipser_matching
+{
+    typedef typename boost::graph_traits<Graph>::vertex_descriptor vertex;
+    typedef typename boost::graph_traits<Graph>::adjacency_iterator 
+        adjacency_iterator;
+
+    static void find_matching(const Graph& g, MateMap mate)
+    {
+        using namespace boost;
+        vertex n = num_vertices(g);
+        vertex null_vertex = graph_traits<Graph>::null_vertex();
+        
+        // deg is the number of unmatched neighbors
+        std::vector<vertex> deg(n,0), order(n), ones;
+        for (vertex u=0; u<n; ++u) {
+            put(mate, u, null_vertex);
+            order[u] = u;
+            adjacency_iterator ai, aend;
+            for (tie(ai,aend)=adjacent_vertices(u,g); ai!=aend; ++ai) {
+                if (*ai != u) { ++deg[u]; }
+            }
+            if (deg[u] == 1) { ones.push_back(u); }
+        }
+        
+        boost::mt19937 gen(5489u);
+        for (vertex i=n; i>1; --i) {
+            boost::uniform_int<vertex> dist(0,i-1);
+            std::swap(order[i-1], order[dist(gen)]);
+        }
+        
+        vertex next = 0;
+        while (1) {
+            vertex u = null_vertex, v = null_vertex;
+            if (!ones.empty()) {
+                u = ones.back(); ones.pop_back();
+                if (get(mate,u) != null_vertex || deg[u] == 0) { continue; }
+            } else {
+                while (next < n && 
+                    (get(mate,order[next]) != null_vertex || deg[order[next]] == 0)) 
+                { ++next; }
+                if (next == n) { break; }
+                u = order[next];
+            }
+            adjacency_iterator ai, aend;
+            for (tie(ai,aend)=adjacent_vertices(u,g); ai!=aend; ++ai) {
+                if (*ai == u || get(mate,*ai) != null_vertex) { continue; }
+                if (v == null_vertex || deg[*ai] < deg[v]) { v = *ai; }
+            }
+            put(mate, u, v);
+            put(mate, v, u);
+            // remove u and v from the degrees of their neighbors
+            vertex ends[2] = {u, v};
+            for (int k=0; k<2; ++k) {
+                for (tie(ai,aend)=adjacent_vertices(ends[k],g); ai!=aend; ++ai) {
+                    vertex w = *ai;
+                    if (w == ends[k] || get(mate,w) != null_vertex) { continue; }
+                    if (--deg[w] == 1) { ones.push_back(w); }
+                }
+            }
+        }
+    }
+};
+
+/** A fixed random priority for the undirected edge (u,v) in a round of
+ * the parallel greedy matching.  Ties are broken by the vertex indices.
+ */
+template <typename Vertex>
+static inline bool greedy_edge_less(Vertex u1, Vertex v1, Vertex u2, Vertex v2,
+    unsigned int round)
+{
+    if (u1 > v1) { std::swap(u1,v1); }
+    if (u2 > v2) { std::swap(u2,v2); }
+    unsigned int h1 = (unsigned int)u1*2654435761u ^ (unsigned int)v1 ^ round;
+    unsigned int h2 = (unsigned int)u2*2654435761u ^ (unsigned int)v2 ^ round;
+    h1 ^= h1 >> 16; h1 *= 0x85ebca6bu; h1 ^= h1 >> 13; h1 *= 0xc2b2ae35u;
+    h2 ^= h2 >> 16; h2 *= 0x85ebca6bu; h2 ^= h2 >> 13; h2 *= 0xc2b2ae35u;
+    if (h1 != h2) { return h1 < h2; }
+    if (u1 != u2) { return u1 < u2; }
+    return v1 < v2;
+}
+
+/** Compute an initial matching with a parallel randomized greedy 
+ * algorithm.
+ *
+ * Each round gives the edges a random priority and every unmatched 
+ * vertex points to the unmatched neighbor along its heaviest edge.  Pairs
+ * of vertices that point to each other are matched.  The heaviest 
+ * remaining edge is always matched, so the rounds end with a maximal 
+ * matching, usually after O(log n) rounds.  The rounds are split among
+ * OpenMP threads and the output does not depend on the number of threads.
+ *
+ * The vertices of the graph must be the indices 0 to num_vertices(g)-1.
+ */
+template <typename Graph, typename MateMap>
+struct parallel_greedy_matching
+{
+    typedef typename boost::graph_traits<Graph>::vertex_descriptor vertex;
+    typedef typename boost::graph_traits<Graph>::adjacency_iterator 
+        adjacency_iterator;
+
+    static void find_matching(const Graph& g, MateMap mate)
+    {
+        using namespace boost;
+        vertex n = num_vertices(g);
+        vertex null_vertex = graph_traits<Graph>::null_vertex();
+        
+        std::vector<vertex> active(n), candidate(n, null_vertex);
+        for (vertex u=0; u<n; ++u) { put(mate, u, null_vertex); active[u] = u; }
+        
+        for (unsigned int round=0; !active.empty(); ++round) {
+            ptrdiff_t nactive = (ptrdiff_t)active.size();
+            #pragma omp parallel for schedule(dynamic, 256)
+            for (ptrdiff_t i=0; i<nactive; ++i) {
+                vertex u = active[i], best = null_vertex;
+                adjacency_iterator ai, aend;
+                for (tie(ai,aend)=adjacent_vertices(u,g); ai!=aend; ++ai) {
+                    vertex v = *ai;
+                    if (v == u || get(mate,v) != null_vertex) { continue; }
+                    if (best == null_vertex || 
+                        greedy_edge_less(u, best, u, v, round)) { best = v; }
+                }
+                candidate[u] = best;
+            }
+            #pragma omp parallel for schedule(static)
+            for (ptrdiff_t i=0; i<nactive; ++i) {
+                vertex u = active[i], v = candidate[u];
+                if (v != null_vertex && candidate[v] == u) { put(mate, u, v); }
+            }
+            // keep the unmatched vertices with an unmatched neighbor
+            vertex nnext = 0;
+            for (ptrdiff_t i=0; i<nactive; ++i) {
+                vertex u = active[i];
+                if (get(mate,u) == null_vertex && candidate[u] != null_vertex) {
+                    active[nnext++] = u;
+                }
+            }
+            active.resize(nnext);
+        }
+    }
+};
+
+template <template <typename, typename> class InitialMatchingFinder,
+        typename Graph,
+        typename MateMap,
+        typename VertexIndexMap>
+bool matching_help_initial(const Graph& g, MateMap mate, VertexIndexMap vm,
+                   int augmenting_path, int verify)
+{
+    using namespace boost;
+    if (augmenting_path == 1)
+        if (verify == 1)
+            return matching<Graph,MateMap,VertexIndexMap,
+                    no_augmenting_path_finder,
+                    InitialMatchingFinder,
+                    no_matching_verifier>
+                    (g, mate, vm);
+        else
+            return matching<Graph,MateMap,VertexIndexMap,
+                    no_augmenting_path_finder,
+                    InitialMatchingFinder,
+                    maximum_cardinality_matching_verifier>
+                    (g, mate, vm);
+    else
+        if (verify == 1)
+            return matching<Graph,MateMap,VertexIndexMap,
+                    edmonds_augmenting_path_finder,
+                    InitialMatchingFinder,
+                    no_matching_verifier>
+                    (g, mate, vm);
+        else
+            return matching<Graph,MateMap,VertexIndexMap,
+                    edmonds_augmenting_path_finder,
+                    InitialMatchingFinder,
+                    maximum_cardinality_matching_verifier>
+                    (g, mate, vm);
+}
+
+template <typename Graph,
+        typename MateMap,
+        typename VertexIndexMap>
+bool matching_help(const Graph& g, MateMap mate, VertexIndexMap vm,
+                   int initial_matching, int augmenting_path, int verify)
+{
+    using namespace boost;
+    switch (initial_matching)
+    {
+        case 1:
+            return matching_help_initial<empty_matching>
+                    (g, mate, vm, augmenting_path, verify);
+        case 2:
+            return matching_help_initial<greedy_matching>
+                    (g, mate, vm, augmenting_path, verify);
+        case 4:
+            return matching_help_initial<karp_sipser_matching>
+                    (g, mate, vm, augmenting_path, verify);
+        case 5:
+            return matching_help_initial<parallel_greedy_matching>
+                    (g, mate, vm, augmenting_path, verify);
+        default:
+            return matching_help_initial<extra_greedy_matching>
+                    (g, mate, vm, augmenting_path, verify);
+    }
+}
+
+/** Wrap a boost graph library call to matching.
+ *
+ * A matching is a subset of edges with no common vertices in an undirected
+ * graph.
+ *
+ * A maximum cardinality matching has the largest number of edges over all
+ * possible matchings.
+ *
+ * The graph must be undirected.
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex
+ * @param ia the row connectivity points into ja
+ * @param mate an array of size nverts which stores the matching vertex index
+ *  or null vertex if there is no match
+ * @param initial_matching indicates the initial matching used in the algorithm
+ *  1: no_matching
+ *  2: greedy_matching
+ *  3: extra_greedy_matching
+ *  4: karp_sipser_matching
+ *  5: parallel_greedy_matching
+ * @param augmenting_path indicates the algorithm used to find augmenting paths
+ *  1: no_augmenting_path_finder
+ *  2: edmonds_augmenting_path_finder
+ * @param verify indicates if we verify the algorithm ouput
+ *  1: no_matching_verifier
+ *  2: maximum_cardinality_matching_verifier
+ * @param verified the output of the verification algorithm (if run), or
+ *  false otherwise
+ * @param null_vertex the special index to indicate an unmatched vertex
+ * @return an error code if possible
+ *   0: indicates success
+ *  -1: indicates a parameter error with initial_matching, augmenting_path, or verify
+ */
+int maximum_cardinality_matching(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
+    mbglIndex* mate, int initial_matching, int augmenting_path, int verify,
+    int *verified, mbglIndex *null_vertex)
+{
+    using namespace yasmic;
+    using namespace boost;
+
+    typedef simple_csr_matrix<mbglIndex,double> crs_graph;
+    crs_graph g(nverts, nverts, ia[nverts], ia, ja, NULL);
+
+    if (initial_matching < 1 || initial_matching > 5 ||
+        augmenting_path < 1 || augmenting_path > 2 ||
+        verify < 1 || verify > 2)
+    {
+        return (-1);
+    }
+
+    bool max_matching =
+        matching_help(g,mate,get(vertex_index,g),
+            initial_matching,augmenting_path,verify);
+
+    if (verified) {
+        *verified = 0;
+        if (verify > 1) { *verified = max_matching; }
+    }
+
+    if (null_vertex) {
+        *null_vertex = graph_traits<crs_graph>::null_vertex();
+    }
+
+    return (0);
+}
+
+template <typename Graph, typename MateMap, typename VertexIndexMap>
+bool verify_matching_help(const Graph& g, MateMap mate, VertexIndexMap vm)
+{
+    return boost::maximum_cardinality_matching_verifier<
+                    Graph,MateMap,VertexIndexMap>::verify_matching(g,mate,vm);
+}
+
+/*
+ * mate = nverts if unmatched
+ */
+int test_maximum_cardinality_matching(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
+    mbglIndex* mate, int *verified)
+{
+    using namespace yasmic;
+    using namespace boost;
+
+    typedef simple_csr_matrix<mbglIndex,double> crs_graph;
+    crs_graph g(nverts, nverts, ia[nverts], ia, ja, NULL);
+
+    // set the null_vertex to the true null
+    mbglIndex true_null = graph_traits<crs_graph>::null_vertex();
+    for (mbglIndex v=0;v<num_vertices(g);++v) {
+        if (mate[v] == nverts) { mate[v] = true_null; }
+    }
+
+    bool max_matching = verify_matching_help(g, mate, get(vertex_index,g));
+    if (verified) { *verified = 0; }
+    if (max_matching && verified) { *verified = 1; }
+
+    return (0);
+}
+
+/** Split the vertices of a graph into two sides with a breadth first 
+ * search.
+ *
+ * @return false if the graph is not bipartite
+ */
+static bool bipartition(mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,
+    std::vector<int>& side)
+{
+    std::vector<mbglIndex> queue;
+    side.assign(nverts, -1);
+    for (mbglIndex s=0; s<nverts; ++s) {
+        if (side[s] >= 0) { continue; }
+        side[s] = 0;
+        queue.clear();
+        queue.push_back(s);
+        for (size_t qi=0; qi<queue.size(); ++qi) {
+            mbglIndex u = queue[qi];
+            for (mbglIndex ri=ia[u]; ri<ia[u+1]; ++ri) {
+                mbglIndex v = ja[ri];
+                if (side[v] < 0) {
+                    side[v] = 1-side[u];
+                    queue.push_back(v);
+                } else if (side[v] == side[u]) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+/** The state of the Hopcroft-Karp algorithm. */
+struct hopcroft_karp_state
+{
+    hopcroft_karp_state(mbglIndex nverts_, mbglIndex *ja_, mbglIndex *ia_,
+        const int *side_, mbglIndex *mate_)
+        : nverts(nverts_), ja(ja_), ia(ia_), side(side_), mate(mate_),
+          none(nverts_), inf(nverts_+1), dist(nverts_), visited(nverts_),
+          edge(nverts_)
+    {}
+
+    /** Compute the layers of the alternating paths from the free left 
+     * vertices with a level synchronous breadth first search.
+     *
+     * @return true if there is an augmenting path
+     */
+    bool layers()
+    {
+        std::vector<mbglIndex> frontier;
+        for (mbglIndex u=0; u<nverts; ++u) {
+            visited[u] = 0;
+            if (side[u] != 0) { continue; }
+            if (mate[u] == none) {
+                dist[u] = 0;
+                visited[u] = 1;
+                frontier.push_back(u);
+            } else {
+                dist[u] = inf;
+            }
+        }
+
+        bool found = false;
+        mbglIndex level = 0;
+        while (!frontier.empty() && !found) {
+            std::vector<mbglIndex> next;
+            const mbglIndex *fp = &frontier[0];
+            ptrdiff_t nfrontier = (ptrdiff_t)frontier.size();
+            int found_free = 0;
+            #pragma omp parallel
+            {
+                std::vector<mbglIndex> local;
+                #pragma omp for schedule(dynamic, 64) reduction(|:found_free)
+                for (ptrdiff_t i=0; i<nfrontier; ++i) {
+                    mbglIndex u = fp[i];
+                    for (mbglIndex ri=ia[u]; ri<ia[u+1]; ++ri) {
+                        mbglIndex v = ja[ri];
+                        if (side[v] != 1) { continue; }
+                        mbglIndex w = mate[v];
+                        if (w == none) { found_free = 1; continue; }
+                        char old;
+                        #pragma omp atomic capture
+                        { old = visited[w]; visited[w] = 1; }
+                        if (!old) {
+                            dist[w] = level+1;
+                            local.push_back(w);
+                        }
+                    }
+                }
+                #pragma omp critical
+                next.insert(next.end(), local.begin(), local.end());
+            }
+            found = found_free != 0;
+            frontier.swap(next);
+            ++level;
+        }
+
+        // reset the visited flags for the right vertices in the search
+        for (mbglIndex u=0; u<nverts; ++u) { visited[u] = 0; }
+        return found;
+    }
+
+    /** Search for an augmenting path from the free left vertex s in the
+     * layered graph and augment the matching along it.  A right vertex
+     * is claimed with an atomic flag, so searches that run at the same 
+     * time find vertex disjoint paths.  Other searches flip their paths
+     * and mark dead ends meanwhile, so mate and dist are accessed 
+     * atomically.
+     *
+     * @return true if the search augmented the matching
+     */
+    bool augment(mbglIndex s, std::vector<mbglIndex>& stack)
+    {
+        stack.clear();
+        stack.push_back(s);
+        edge[s] = ia[s];
+        while (!stack.empty()) {
+            mbglIndex u = stack.back();
+            if (edge[u] == ia[u+1]) {
+                // u is a dead end for the rest of this phase
+                #pragma omp atomic write
+                dist[u] = inf;
+                stack.pop_back();
+                continue;
+            }
+            mbglIndex v = ja[edge[u]++];
+            if (side[v] != 1) { continue; }
+            mbglIndex w, dw;
+            #pragma omp atomic read
+            w = mate[v];
+            if (w != none) {
+                #pragma omp atomic read
+                dw = dist[w];
+                if (dw != dist[u]+1) { continue; }
+            }
+            char old;
+            #pragma omp atomic capture
+            { old = visited[v]; visited[v] = 1; }
+            if (old) { continue; }
+            if (w == none) {
+                // flip the path; the stack holds its left vertices and
+                // edge[u]-1 is the edge to the next right vertex
+                for (size_t i=stack.size(); i>0; --i) {
+                    mbglIndex x = stack[i-1];
+                    mbglIndex y = ja[edge[x]-1];
+                    #pragma omp atomic write
+                    mate[x] = y;
+                    #pragma omp atomic write
+                    mate[y] = x;
+                }
+                return true;
+            }
+            edge[w] = ia[w];
+            stack.push_back(w);
+        }
+        return false;
+    }
+
+    /** Run one phase of searches from all the free left vertices.
+     *
+     * @return the number of augmenting paths
+     */
+    mbglIndex phase(bool parallel)
+    {
+        std::vector<mbglIndex> free;
+        for (mbglIndex u=0; u<nverts; ++u) {
+            if (side[u] == 0 && mate[u] == none) { free.push_back(u); }
+        }
+        mbglIndex naugment = 0;
+        ptrdiff_t nfree = (ptrdiff_t)free.size();
+        #pragma omp parallel if (parallel)
+        {
+            std::vector<mbglIndex> stack;
+            #pragma omp for schedule(dynamic, 16) reduction(+:naugment)
+            for (ptrdiff_t i=0; i<nfree; ++i) {
+                if (augment(free[i], stack)) { ++naugment; }
+            }
+        }
+        for (mbglIndex u=0; u<nverts; ++u) { visited[u] = 0; }
+        return naugment;
+    }
+
+    mbglIndex nverts;
+    mbglIndex *ja, *ia;
+    const int *side;
+    mbglIndex *mate;
+    mbglIndex none, inf;
+    std::vector<mbglIndex> dist;
+    std::vector<char> visited;
+    std::vector<mbglIndex> edge;
+};
+
+/** Compute a maximum cardinality matching in a bipartite graph
+ *
+ * This function uses the Hopcroft-Karp algorithm, which runs in 
+ * O(m sqrt(n)) time.  Each phase computes the layers of the shortest
+ * alternating paths from the free vertices on one side with a level
+ * synchronous breadth first search, and then searches for a maximal set
+ * of vertex disjoint augmenting paths in the layered graph.  Both parts
+ * of a phase are split among OpenMP threads.  When the parallel 
+ * searches interfere so that no path is found, the phase is repeated 
+ * with a single thread.
+ *
+ * The graph must be undirected.
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex
+ * @param ia the row connectivity points into ja
+ * @param side the side of each vertex, 0 or 1 (optional).  If side is 
+ *   NULL, the function finds a bipartition.
+ * @param mate an array of size nverts which stores the matching vertex 
+ *   index or null vertex if there is no match
+ * @param null_vertex the special index to indicate an unmatched vertex
+ * @return an error code if possible
+ *   0: indicates success
+ *  -2: indicates the graph is not bipartite or an edge joins two
+ *      vertices on the same side
+ */
+int bipartite_matching(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
+    int *side, mbglIndex* mate, mbglIndex *null_vertex)
+{
+    using namespace yasmic;
+    using namespace boost;
+
+    typedef simple_csr_matrix<mbglIndex,double> crs_graph;
+
+    std::vector<int> sides;
+    if (!side) {
+        if (!bipartition(nverts, ja, ia, sides)) { return (-2); }
+        side = nverts > 0 ? &sides[0] : NULL;
+    } else {
+        // the search only follows edges from side 0 to side 1, so an
+        // edge inside a side would be dropped from the matching
+        for (mbglIndex u=0; u<nverts; ++u) {
+            for (mbglIndex ri=ia[u]; ri<ia[u+1]; ++ri) {
+                if ((side[u] != 0) == (side[ja[ri]] != 0)) { return (-2); }
+            }
+        }
+    }
+
+    // start from a greedy matching
+    for (mbglIndex u=0; u<nverts; ++u) { mate[u] = nverts; }
+    for (mbglIndex u=0; u<nverts; ++u) {
+        if (side[u] != 0) { continue; }
+        for (mbglIndex ri=ia[u]; ri<ia[u+1]; ++ri) {
+            mbglIndex v = ja[ri];
+            if (side[v] == 1 && mate[v] == nverts) {
+                mate[u] = v;
+                mate[v] = u;
+                break;
+            }
+        }
+    }
+
+    hopcroft_karp_state hk(nverts, ja, ia, side, mate);
+    while (hk.layers()) {
+        if (hk.phase(true) == 0) {
+            // a serial phase always finds a path if one exists
+            hk.layers();
+            if (hk.phase(false) == 0) { break; }
+        }
+    }
+
+    mbglIndex true_null = graph_traits<crs_graph>::null_vertex();
+    for (mbglIndex u=0; u<nverts; ++u) {
+        if (mate[u] == nverts) { mate[u] = true_null; }
+    }
+    if (null_vertex) { *null_vertex = true_null; }
+
+    return (0);
+}
+
+/** Test if the proposal (w,u) beats the proposal (ws,s) in the suitor
+ * matching.  Ties in the weight go to the larger vertex index so all the
+ * threads agree on the order.
+ */
+static inline bool suitor_better(double w, mbglIndex u, double ws, 
+    mbglIndex s, mbglIndex none)
+{
+    if (w != ws) { return w > ws; }
+    return s != none && u > s;
+}
+
+/** Compute a 1/2-approximate maximum weight matching
+ *
+ * This function uses the Suitor algorithm of Manne and Halappanavar.
+ * Each vertex proposes to the neighbor along its heaviest edge whose
+ * current suitor it beats, and a displaced suitor proposes again.  When
+ * the proposals stop, the suitors form the same matching as the greedy
+ * algorithm that adds the heaviest remaining edge, which has at least 
+ * half the weight of a maximum weight matching.  The proposals are split
+ * among OpenMP threads with a lock for each vertex.  
+ *
+ * The graph must be undirected and the weights symmetric.  Edges with 
+ * non-positive weight and self loops are never matched.
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex
+ * @param ia the row connectivity points into ja
+ * @param weight the weight of each edge in the graph
+ * @param mate an array of size nverts which stores the matching vertex 
+ *   index or null vertex if there is no match
+ * @param matching_weight the total weight of the matching (optional)
+ * @param null_vertex the special index to indicate an unmatched vertex
+ * @return an error code if possible
+ *   0: indicates success
+ *  -1: indicates a parameter error with the weights
+ */
+int approximate_weighted_matching(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, double *weight, 
+    mbglIndex *mate, double *matching_weight, mbglIndex *null_vertex)
+{
+    using namespace yasmic;
+    using namespace boost;
+
+    typedef simple_csr_matrix<mbglIndex,double> crs_graph;
+
+    if (!weight) { return (-1); }
+
+    // mate holds the suitor of each vertex until the end
+    mbglIndex none = nverts;
+    std::vector<double> ws(nverts, 0.0);
+    for (mbglIndex u=0; u<nverts; ++u) { mate[u] = none; }
+
+#ifdef _OPENMP
+    std::vector<omp_lock_t> locks(nverts);
+    for (mbglIndex u=0; u<nverts; ++u) { omp_init_lock(&locks[u]); }
+#endif /* _OPENMP */
+
+    #pragma omp parallel for schedule(dynamic, 256)
+    for (ptrdiff_t i=0; i<(ptrdiff_t)nverts; ++i) {
+        mbglIndex u = (mbglIndex)i;
+        while (u != none) {
+            // find the best neighbor that would accept u
+            mbglIndex partner = none;
+            double heaviest = 0.0;
+            for (mbglIndex ri=ia[u]; ri<ia[u+1]; ++ri) {
+                mbglIndex v = ja[ri];
+                double w = weight[ri];
+                if (v == u || !suitor_better(w, v, heaviest, partner, none)) {
+                    continue;
+                }
+                double wv; mbglIndex sv;
+                #pragma omp atomic read
+                wv = ws[v];
+                #pragma omp atomic read
+                sv = mate[v];
+                if (suitor_better(w, u, wv, sv, none)) {
+                    partner = v;
+                    heaviest = w;
+                }
+            }
+            if (partner == none) { break; }
+            
+            mbglIndex next = u;
+#ifdef _OPENMP
+            omp_set_lock(&locks[partner]);
+#endif /* _OPENMP */
+            // check that u still beats the suitor
+            if (suitor_better(heaviest, u, ws[partner], mate[partner], none)) {
+                next = mate[partner];
+                #pragma omp atomic write
+                mate[partner] = u;
+                #pragma omp atomic write
+                ws[partner] = heaviest;
+            }
+#ifdef _OPENMP
+            omp_unset_lock(&locks[partner]);
+#endif /* _OPENMP */
+            // the displaced suitor proposes next, or u tries again
+            u = next;
+        }
+    }
+
+#ifdef _OPENMP
+    for (mbglIndex u=0; u<nverts; ++u) { omp_destroy_lock(&locks[u]); }
+#endif /* _OPENMP */
+
+    // the suitors are symmetric, convert them into the output
+    mbglIndex true_null = graph_traits<crs_graph>::null_vertex();
+    double total = 0.0;
+    for (mbglIndex u=0; u<nverts; ++u) {
+        if (mate[u] == none || mate[mate[u]] != u) { continue; }
+        if (u < mate[u]) { total += ws[u]; }
+    }
+    for (mbglIndex u=0; u<nverts; ++u) {
+        if (mate[u] != none && mate[mate[u]] != u) { mate[u] = true_null; }
+    }
+    for (mbglIndex u=0; u<nverts; ++u) {
+        if (mate[u] == none) { mate[u] = true_null; }
+    }
+    if (matching_weight) { *matching_weight = total; }
+    if (null_vertex) { *null_vertex = true_null; }
+
+    return (0);
+}
+
+/** Replace *p with desired if it still holds expected
+ *
+ * OpenMP before 5.1 has no compare and swap, so this uses the compiler
+ * intrinsics.
+ *
+ * @return true if *p held expected and now holds desired
+ */
+static inline bool compare_and_swap(mbglDegreeType *p,
+    mbglDegreeType expected, mbglDegreeType desired)
+{
+#if defined(_OPENMP) && defined(_MSC_VER)
+    if (sizeof(mbglDegreeType) == sizeof(__int64)) {
+        return (_InterlockedCompareExchange64((volatile __int64*)p,
+            (__int64)desired, (__int64)expected) == (__int64)expected);
+    }
+    return (_InterlockedCompareExchange((volatile long*)p,
+        (long)desired, (long)expected) == (long)expected);
+#elif defined(_OPENMP)
+    return (__sync_bool_compare_and_swap(p, expected, desired));
+#else
+    if (*p != expected) { return (false); }
+    *p = desired;
+    return (true);
+#endif /* _OPENMP */
+}
+
+/** Compute the in-degree core numbers with level synchronous peeling
+ *
+ * This is the PKC algorithm from Kabir and Madduri, "Parallel k-core
+ * decomposition on multicore platforms," 2017.  At level k, each thread
+ * scans its share of the remaining vertices for those with core number
+ * k into a private buffer and then removes the vertices in its buffer.
+ * A vertex whose in-degree drops to k during a removal goes into the
+ * buffer of the thread that removed its last edge above k, so the
+ * threads only synchronize between levels.
+ *
+ * @param cn the core numbers, length nverts
+ */
+static void parallel_core_numbers(
+    mbglIndex nverts, const mbglIndex *ja, const mbglIndex *ia,
+    mbglDegreeType *cn)
+{
+    for (mbglIndex v=0; v<nverts; ++v) { cn[v] = 0; }
+    for (mbglIndex k=0; k<ia[nverts]; ++k) { ++cn[ja[k]]; }
+
+    std::vector<mbglIndex> remaining(nverts);
+    for (mbglIndex v=0; v<nverts; ++v) { remaining[v] = v; }
+
+    mbglDegreeType level = 0;
+    while (!remaining.empty()) {
+        // skip the levels without any vertices
+        level = cn[remaining[0]];
+        for (mbglIndex i=1; i<(mbglIndex)remaining.size(); ++i) {
+            level = (std::min)(level, cn[remaining[i]]);
+        }
+
+        #pragma omp parallel
+        {
+            std::vector<mbglIndex> buffer;
+            #pragma omp for schedule(static)
+            for (ptrdiff_t i=0; i<(ptrdiff_t)remaining.size(); ++i) {
+                if (cn[remaining[i]] == level) { buffer.push_back(remaining[i]); }
+            }
+            for (size_t bi=0; bi<buffer.size(); ++bi) {
+                mbglIndex v = buffer[bi];
+                for (mbglIndex k=ia[v]; k<ia[v+1]; ++k) {
+                    mbglIndex u = ja[k];
+                    // never take the degree below the level, so the
+                    // count is exact whenever another thread reads it
+                    mbglDegreeType cu;
+                    #pragma omp atomic read
+                    cu = cn[u];
+                    while (cu > level) {
+                        if (compare_and_swap(&cn[u], cu, cu-1)) {
+                            if (cu == level+1) { buffer.push_back(u); }
+                            break;
+                        }
+                        #pragma omp atomic read
+                        cu = cn[u];
+                    }
+                }
+            }
+        }
+
+        // keep the vertices above this level
+        mbglIndex nremaining = 0;
+        for (mbglIndex i=0; i<(mbglIndex)remaining.size(); ++i) {
+            if (cn[remaining[i]] > level) { remaining[nremaining++] = remaining[i]; }
+        }
+        remaining.resize(nremaining);
+    }
+}
+
+/** Compute the core_numbers of a graph
+ *
+ * For an undirected graph, this function computes the core number of each
+ * vertex.  The core number is the minimum number such that removing all
+ * vertices of degree <= cn[k] removes vertex k.  For a directed graph
+ * we compute the in-degree core number.
+ *
+ * The removal times are only defined for the sequential algorithm.  If
+ * rt is NULL, we use a parallel level synchronous algorithm instead.
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex
+ * @param ia the row connectivity points into ja
+ * @param cn an array of core numbers, length nverts
+ * @param rt an array of removal times, length nverts (optional)
+ * @return an error code if possible
+ */
+int core_numbers(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
+    mbglDegreeType *cn, int *rt)
+{
+    // History
+    //
+    // 30 July 2007
+    // added removal time visitor
+    // changed to mbglDegreeType
+    //
+    // 19 October 2026
+    // made rt optional and added the parallel algorithm
+    using namespace yasmic;
+    using namespace boost;
+
+    if (!cn) { return (-1); }
+
+    if (!rt) {
+        parallel_core_numbers(nverts, ja, ia, cn);
+        return (0);
+    }
+
+    typedef simple_csr_matrix<mbglIndex,double> crs_graph;
+    crs_graph g(nverts, nverts, ia[nverts], ia, ja, NULL);
+
+    int time = 0;
+
+    core_numbers(g, make_iterator_property_map(cn, get(vertex_index,g)),
+        make_core_numbers_visitor(stamp_times(rt, time, on_examine_vertex())));
+
+    return (0);
+}
+
+/** A view of a graph in the middle of a batch of edge updates.
+ *
+ * The CSR arrays hold the graph after all the updates.  The inserted
+ * edges that we haven't processed yet are hidden, and the deleted edges
+ * that we haven't processed yet are added back.
+ */
+class core_update_graph
+{
+public:
+    typedef std::pair<mbglIndex,mbglIndex> edge;
+
+    core_update_graph(mbglIndex nverts_, const mbglIndex *ja_,
+        const mbglIndex *ia_)
+        : nverts(nverts_), ja(ja_), ia(ia_), nhidden(nverts_)
+    {}
+
+    void hide(mbglIndex u, mbglIndex v) {
+        if (hidden.insert(edge(u,v)).second) { ++nhidden[u]; }
+        if (hidden.insert(edge(v,u)).second) { ++nhidden[v]; }
+    }
+
+    void show(mbglIndex u, mbglIndex v) {
+        if (hidden.erase(edge(u,v))) { --nhidden[u]; }
+        if (hidden.erase(edge(v,u))) { --nhidden[v]; }
+    }
+
+    void add(mbglIndex u, mbglIndex v) {
+        extra.insert(edge(u,v));
+        if (u != v) { extra.insert(edge(v,u)); }
+    }
+
+    void remove(mbglIndex u, mbglIndex v) {
+        std::multimap<mbglIndex,mbglIndex>::iterator ei;
+        for (ei=extra.lower_bound(u); ei!=extra.end() && ei->first==u; ++ei) {
+            if (ei->second == v) { extra.erase(ei); break; }
+        }
+        if (u == v) { return; }
+        for (ei=extra.lower_bound(v); ei!=extra.end() && ei->first==v; ++ei) {
+            if (ei->second == u) { extra.erase(ei); break; }
+        }
+    }
+
+    /** Call vis(x) for each neighbor x of u in the current graph. */
+    template <class Visitor>
+    void visit(mbglIndex u, Visitor& vis) const {
+        for (mbglIndex k=ia[u]; k<ia[u+1]; ++k) {
+            if (nhidden[u] > 0 && hidden.count(edge(u,ja[k]))) { continue; }
+            vis(ja[k]);
+        }
+        std::multimap<mbglIndex,mbglIndex>::const_iterator ei;
+        for (ei=extra.lower_bound(u); ei!=extra.end() && ei->first==u; ++ei) {
+            vis(ei->second);
+        }
+    }
+
+    mbglIndex nverts;
+    const mbglIndex *ja, *ia;
+    std::set<edge> hidden;
+    std::vector<mbglIndex> nhidden;
+    std::multimap<mbglIndex,mbglIndex> extra;
+};
+
+/** Update the core numbers in the subcore of a changed edge.
+ *
+ * This is the traversal algorithm from Sariyuce et al., "Streaming
+ * algorithms for k-core decomposition," VLDB 2013.  Only vertices with
+ * core number K = min(cn[u],cn[v]) that are connected to the lower
+ * endpoint through other vertices with core number K can change.  We
+ * collect this subcore, count the neighbors of each vertex with core
+ * number at least K, and then peel the subcore.  After an insertion,
+ * the vertices that survive the peel move up to K+1; after a deletion,
+ * the vertices that are peeled move down to K-1.
+ */
+class core_number_updater
+{
+public:
+    core_number_updater(const core_update_graph& g_, mbglDegreeType *cn_)
+        : g(g_), cn(cn_), in_subcore(g_.nverts), evicted(g_.nverts),
+          cd(g_.nverts), nvisited(0)
+    {}
+
+    void update(mbglIndex u, mbglIndex v, bool insertion) {
+        mbglDegreeType K = (std::min)(cn[u], cn[v]);
+        if (!insertion && K == 0) { return; }
+        subcore.clear();
+        if (cn[u] == K) { add_to_subcore(u); }
+        if (cn[v] == K) { add_to_subcore(v); }
+        // grow the subcore with a breadth first search
+        for (size_t i=0; i<subcore.size(); ++i) {
+            grow_visitor grow = {this, K};
+            g.visit(subcore[i], grow);
+        }
+        nvisited += (mbglIndex)subcore.size();
+
+        // vertices are evicted when they can't stay in the K+1 core
+        // (insertion) or the K core (deletion)
+        mbglDegreeType keep = insertion ? K+1 : K;
+        std::vector<mbglIndex> queue;
+        for (size_t i=0; i<subcore.size(); ++i) {
+            mbglIndex w = subcore[i];
+            count_visitor count = {this, K, 0};
+            g.visit(w, count);
+            cd[w] = count.degree;
+            if (cd[w] < keep) { evicted[w] = 1; queue.push_back(w); }
+        }
+        for (size_t i=0; i<queue.size(); ++i) {
+            evict_visitor evict = {this, keep, &queue};
+            g.visit(queue[i], evict);
+        }
+
+        for (size_t i=0; i<subcore.size(); ++i) {
+            mbglIndex w = subcore[i];
+            if (insertion && !evicted[w]) { cn[w] = K+1; }
+            if (!insertion && evicted[w]) { cn[w] = K-1; }
+            in_subcore[w] = 0; evicted[w] = 0; cd[w] = 0;
+        }
+    }
+
+    mbglIndex visited() const { return nvisited; }
+
+private:
+    void add_to_subcore(mbglIndex w) {
+        if (!in_subcore[w]) { in_subcore[w] = 1; subcore.push_back(w); }
+    }
+
+    struct grow_visitor {
+        core_number_updater *up; mbglDegreeType K;
+        void operator() (mbglIndex x) {
+            if (up->cn[x] == K) { up->add_to_subcore(x); }
+        }
+    };
+
+    struct count_visitor {
+        core_number_updater *up; mbglDegreeType K; mbglDegreeType degree;
+        void operator() (mbglIndex x) {
+            if (up->cn[x] >= K) { ++degree; }
+        }
+    };
+
+    struct evict_visitor {
+        core_number_updater *up; mbglDegreeType keep;
+        std::vector<mbglIndex> *queue;
+        void operator() (mbglIndex x) {
+            if (up->in_subcore[x] && !up->evicted[x]) {
+                if (--up->cd[x] < keep) {
+                    up->evicted[x] = 1;
+                    queue->push_back(x);
+                }
+            }
+        }
+    };
+
+    const core_update_graph& g;
+    mbglDegreeType *cn;
+    std::vector<char> in_subcore, evicted;
+    std::vector<mbglDegreeType> cd;
+    std::vector<mbglIndex> subcore;
+    mbglIndex nvisited;
+};
+
+/** Update the core numbers of a graph after a batch of edge changes
+ *
+ * Given the core numbers of a graph, this function computes the core
+ * numbers after a batch of edge insertions and deletions.  The graph
+ * arrays ja and ia are the graph after all the changes.  Each change
+ * only visits the vertices in the subcore of the edge, that is, the
+ * vertices connected to the edge through vertices with the same core
+ * number, so the work is proportional to the affected region plus an
+ * O(nverts) workspace for each batch.
+ *
+ * Each edge is listed once and the graph must be undirected.  An
+ * inserted edge must be in the graph (both directions) and a deleted
+ * edge must not be.
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex after the changes
+ * @param ia the row connectivity points into ja after the changes
+ * @param ninsert the number of inserted edges
+ * @param insert_i the first vertex of each inserted edge
+ * @param insert_j the second vertex of each inserted edge
+ * @param ndelete the number of deleted edges
+ * @param delete_i the first vertex of each deleted edge
+ * @param delete_j the second vertex of each deleted edge
+ * @param cn the core numbers before the changes on input and after the
+ *   changes on output, length nverts
+ * @param nvisited the total size of the subcores visited (optional)
+ * @return an error code if possible
+ *   0: indicates success
+ *  -1: indicates a vertex out of range
+ */
+int update_core_numbers(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
+    mbglIndex ninsert, mbglIndex *insert_i, mbglIndex *insert_j,
+    mbglIndex ndelete, mbglIndex *delete_i, mbglIndex *delete_j,
+    mbglDegreeType *cn, mbglIndex *nvisited)
+{
+    if (!cn) { return (-1); }
+    for (mbglIndex e=0; e<ninsert; ++e) {
+        if (insert_i[e] >= nverts || insert_j[e] >= nverts) { return (-1); }
+    }
+    for (mbglIndex e=0; e<ndelete; ++e) {
+        if (delete_i[e] >= nverts || delete_j[e] >= nverts) { return (-1); }
+    }
+
+    // start from the graph before the changes
+    core_update_graph g(nverts, ja, ia);
+    for (mbglIndex e=0; e<ninsert; ++e) { g.hide(insert_i[e], insert_j[e]); }
+    for (mbglIndex e=0; e<ndelete; ++e) { g.add(delete_i[e], delete_j[e]); }
+
+    core_number_updater up(g, cn);
+    for (mbglIndex e=0; e<ndelete; ++e) {
+        g.remove(delete_i[e], delete_j[e]);
+        up.update(delete_i[e], delete_j[e], false);
+    }
+    for (mbglIndex e=0; e<ninsert; ++e) {
+        g.show(insert_i[e], insert_j[e]);
+        up.update(insert_i[e], insert_j[e], true);
+    }
+
+    if (nvisited) { *nvisited = up.visited(); }
+
+    return (0);
+}
+
+/** Run the weighted core numbers with a bucket queue or a d-ary heap
+ *
+ * The bucket queue needs non-negative integer weights, but then update
+ * is O(1) instead of O(log n).
+ */
+template <typename Graph, typename CoreMap, typename Visitor>
+void weighted_core_numbers_dispatch(const Graph& g, CoreMap c,
+    bool use_buckets, Visitor vis)
+{
+    using namespace boost;
+    typedef typename graph_traits<Graph>::vertex_descriptor vertex;
+    typedef typename property_map<Graph, vertex_index_t>::const_type IndexMap;
+    IndexMap im = get(vertex_index,g);
+    if (use_buckets) {
+        detail::integer_bucket_queue<vertex, CoreMap, IndexMap>
+            Q(num_vertices(g), c, im);
+        core_numbers_with_queue(g, c, get(edge_weight,g), im, Q, vis);
+    } else {
+        detail::indexed_d_ary_heap<vertex, CoreMap, IndexMap>
+            Q(num_vertices(g), c, im);
+        core_numbers_with_queue(g, c, get(edge_weight,g), im, Q, vis);
+    }
+}
+
+/** Compute the weighted core numbers of a graph
+ *
+ * For an undirected graph, this function computes the core number of each
+ * vertex.  The core number is the minimum number such that removing all
+ * vertices of weighted in-degree <= cn[k] removes vertex k.  For a
+ * directed graph we compute the weighted in-degree core number.
+ *
+ * When the weights are non-negative integers and the largest weighted
+ * in-degree is at most nverts + nnz, the vertices are kept in a bucket
+ * queue.  Otherwise, they are kept in a 4-ary heap.  Ties are broken
+ * by the vertex index in the heap.
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex
+ * @param ia the row connectivity points into ja
+ * @param cn an array of core numbers, length nverts
+ * @param rt an array of removal times, length nverts (optional)
+ * @return an error code if possible
+ */
+int weighted_core_numbers(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, double *weight, /* connectivity params */
+    double *cn, int *rt)
+{
+    // History
+    //
+    // 30 July 2007
     // added removal time visitor
+    //
+    // 19 October 2026
+    // replaced mutable_queue with a bucket queue or d-ary heap
+    // made rt optional
     using namespace yasmic;
     using namespace boost;
 
+    if (!cn) { return (-1); }
+
     typedef simple_csr_matrix<mbglIndex,double> crs_graph;
     crs_graph g(nverts, nverts, ia[nverts], ia, ja, weight);
 
+    // check if the weighted in-degrees fit in a bucket queue
+    mbglIndex nz = ia[nverts];
+    bool use_buckets = true;
+    std::vector<double> in_weight(nverts);
+    for (mbglIndex k=0; k<nz && use_buckets; ++k) {
+        if (weight[k] < 0 || floor(weight[k]) != weight[k]) { use_buckets = false; }
+        else { in_weight[ja[k]] += weight[k]; }
+    }
+    for (mbglIndex v=0; v<nverts && use_buckets; ++v) {
+        if (in_weight[v] > (double)nverts + (double)nz) { use_buckets = false; }
+    }
+
     int time=0;
 
-    weighted_core_numbers(g, make_iterator_property_map(cn, get(vertex_index,g)),
-        make_core_numbers_visitor(stamp_times(rt, time, on_examine_vertex())));
+    if (rt) {
+        weighted_core_numbers_dispatch(g,
+            make_iterator_property_map(cn, get(vertex_index,g)), use_buckets,
+            make_core_numbers_visitor(stamp_times(rt, time, on_examine_vertex())));
+    } else {
+        weighted_core_numbers_dispatch(g,
+            make_iterator_property_map(cn, get(vertex_index,g)), use_buckets,
+            make_core_numbers_visitor(null_visitor()));
+    }
+
+    return (0);
+}
+
+/** Orient the edges of an undirected graph from low to high degree, with
+ * ties broken by the vertex index.  Each triangle has exactly one vertex
+ * where both other vertices are forward.
+ */
+struct degree_orientation
+{
+    const mbglIndex *ia;
+    degree_orientation(const mbglIndex *ia_) : ia(ia_) {}
+    bool operator() (mbglIndex u, mbglIndex v) const {
+        mbglIndex du = ia[u+1]-ia[u], dv = ia[v+1]-ia[v];
+        return (du < dv || (du == dv && u < v));
+    }
+};
+
+/** Find all the triangles (u,v,w) where u is the lowest vertex in the
+ * degree orientation.
+ *
+ * The visitor is called with the vertices and the positions of the edges
+ * (u,v), (v,w), and (u,w), each of which is in the row of its lower
+ * vertex.  If the visitor returns false, the search stops.
+ *
+ * @param mark a workspace of length nverts that must be filled with
+ *   ia[nverts] and is restored on exit
+ * @return false if the visitor stopped the search
+ */
+template <class TriangleVisitor>
+bool vertex_triangles(mbglIndex u, const mbglIndex *ja, const mbglIndex *ia,
+    degree_orientation fwd, mbglIndex *mark, mbglIndex none,
+    TriangleVisitor& vis)
+{
+    bool cont = true;
+    for (mbglIndex k=ia[u]; k<ia[u+1]; ++k) {
+        if (fwd(u,ja[k])) { mark[ja[k]] = k; }
+    }
+    for (mbglIndex k1=ia[u]; k1<ia[u+1] && cont; ++k1) {
+        mbglIndex v = ja[k1];
+        if (!fwd(u,v)) { continue; }
+        for (mbglIndex k2=ia[v]; k2<ia[v+1]; ++k2) {
+            mbglIndex w = ja[k2];
+            if (mark[w] != none && fwd(v,w)) {
+                if (!vis(u, v, w, k1, k2, mark[w])) { cont = false; break; }
+            }
+        }
+    }
+    for (mbglIndex k=ia[u]; k<ia[u+1]; ++k) { mark[ja[k]] = none; }
+    return cont;
+}
+
+struct triangle_support_visitor
+{
+    mbglDegreeType *support;
+    mbglIndex ntri;
+    triangle_support_visitor(mbglDegreeType *s) : support(s), ntri(0) {}
+    bool operator() (mbglIndex, mbglIndex, mbglIndex,
+        mbglIndex k1, mbglIndex k2, mbglIndex k3)
+    {
+        ++ntri;
+        if (support) {
+            #pragma omp atomic
+            ++support[k1];
+            #pragma omp atomic
+            ++support[k2];
+            #pragma omp atomic
+            ++support[k3];
+        }
+        return true;
+    }
+};
+
+struct triangle_callback_visitor
+{
+    int (*tri)(void*, mbglIndex, mbglIndex, mbglIndex,
+        mbglIndex, mbglIndex, mbglIndex);
+    void *pdata;
+    bool operator() (mbglIndex u, mbglIndex v, mbglIndex w,
+        mbglIndex k1, mbglIndex k2, mbglIndex k3)
+    {
+        return (tri(pdata, u, v, w, k1, k2, k3) != 0);
+    }
+};
+
+/** Count the triangles in a graph
+ *
+ * This function counts the total number of triangles and the number of
+ * triangles that contain each edge (the edge support).  The support
+ * is indexed by the position of the edge in ja, which is the same as the
+ * edge order from indexed_sparse, and both (u,v) and (v,u) get the same
+ * value.
+ *
+ * The algorithm orients each edge from low to high degree and then
+ * intersects the forward neighborhoods, which takes O(m^1.5) time.  The
+ * vertices are processed in parallel with OpenMP.
+ *
+ * The graph must be undirected.  Self-loops are ignored.
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex
+ * @param ia the row connectivity points into ja
+ * @param support an array of edge supports, length ia[nverts] (optional)
+ * @param ntriangles the total number of triangles (optional)
+ * @return an error code if possible
+ */
+int triangle_counts(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
+    mbglDegreeType *support, double *ntriangles)
+{
+    mbglIndex nz = ia[nverts];
+    degree_orientation fwd(ia);
+
+    if (support) {
+        for (mbglIndex k=0; k<nz; ++k) { support[k] = 0; }
+    }
+
+    double ntri = 0.0;
+    #pragma omp parallel reduction(+:ntri)
+    {
+        std::vector<mbglIndex> mark(nverts, nz);
+        triangle_support_visitor vis(support);
+        #pragma omp for schedule(dynamic,64)
+        for (ptrdiff_t u=0; u<(ptrdiff_t)nverts; ++u) {
+            vertex_triangles((mbglIndex)u, ja, ia, fwd,
+                nverts > 0 ? &mark[0] : NULL, nz, vis);
+        }
+        ntri += (double)vis.ntri;
+    }
+    if (ntriangles) { *ntriangles = ntri; }
+
+    if (support && nz > 0) {
+        // copy the support from the forward edge to the backward edge
+        std::vector<mbglIndex> rev(nz);
+        build_reverse_edge_index(nverts, ja, ia, &rev[0]);
+        for (mbglIndex u=0; u<nverts; ++u) {
+            for (mbglIndex k=ia[u]; k<ia[u+1]; ++k) {
+                if (ja[k] != u && fwd(u,ja[k]) && rev[k] < nz) {
+                    support[rev[k]] = support[k];
+                }
+            }
+        }
+    }
+
+    return (0);
+}
 
+/** List the triangles in a graph
+ *
+ * The callback tri is called once for each triangle (u,v,w) with the
+ * indices of the edges (u,v), (v,w), and (u,w) in ja.  If the callback
+ * returns 0, the listing stops.  The triangles are listed sequentially
+ * in the same order as triangle_counts finds them.
+ *
+ * The graph must be undirected.  Self-loops are ignored.
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex
+ * @param ia the row connectivity points into ja
+ * @param tri the triangle callback
+ * @param pdata the data passed to the triangle callback
+ * @return an error code if possible
+ */
+int triangle_list(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
+    int (*tri)(void *pdata, mbglIndex u, mbglIndex v, mbglIndex w,
+        mbglIndex euv, mbglIndex evw, mbglIndex euw),
+    void *pdata)
+{
+    if (!tri) { return (-1); }
+    mbglIndex nz = ia[nverts];
+    std::vector<mbglIndex> mark(nverts, nz);
+    triangle_callback_visitor vis = {tri, pdata};
+    for (mbglIndex u=0; u<nverts; ++u) {
+        if (!vertex_triangles(u, ja, ia, degree_orientation(ia),
+                &mark[0], nz, vis)) {
+            break;
+        }
+    }
     return (0);
 }
 
+/** Compute the truss numbers of the edges in a graph
+ *
+ * The k-truss is the largest subgraph where each edge is in at least
+ * k-2 triangles.  The truss number of an edge is the largest k such that
+ * the edge is in the k-truss.  Edges that are not in any triangle have
+ * truss number 2 and self-loops have truss number 0.  The output is
+ * indexed by the position of the edge in ja, just like the support in
+ * triangle_counts.
+ *
+ * The algorithm computes the edge support in parallel with
+ * triangle_counts and then peels the edges in order of support with a
+ * bin sort, which is the edge analogue of the core_numbers algorithm.
+ *
+ * The graph must be undirected.
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex
+ * @param ia the row connectivity points into ja
+ * @param truss an array of truss numbers, length ia[nverts]
+ * @return an error code if possible
+ */
+int truss_numbers(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia, /* connectivity params */
+    mbglDegreeType *truss)
+{
+    if (!truss) { return (-1); }
+    mbglIndex nz = ia[nverts];
+    if (nz == 0) { return (0); }
+
+    degree_orientation fwd(ia);
+    std::vector<mbglDegreeType> sup(nz);
+    triangle_counts(nverts, ja, ia, &sup[0], NULL);
+    std::vector<mbglIndex> rev(nz), src(nz);
+    build_reverse_edge_index(nverts, ja, ia, &rev[0]);
+
+    // the forward edge of each pair is the canonical edge that we peel
+    std::vector<mbglIndex> edges;
+    mbglDegreeType max_sup = 0;
+    for (mbglIndex u=0; u<nverts; ++u) {
+        for (mbglIndex k=ia[u]; k<ia[u+1]; ++k) {
+            src[k] = u;
+            truss[k] = 0;
+            if (ja[k] != u && fwd(u,ja[k])) {
+                edges.push_back(k);
+                max_sup = (std::max)(max_sup, sup[k]);
+            }
+        }
+    }
+    mbglIndex nedges = (mbglIndex)edges.size();
+
+    // bin sort the edges by support, just like the core numbers
+    std::vector<mbglIndex> bin(max_sup+2), pos(nz), order(nedges);
+    for (mbglIndex i=0; i<nedges; ++i) { ++bin[sup[edges[i]]+1]; }
+    for (mbglDegreeType d=0; d<=max_sup; ++d) { bin[d+1] += bin[d]; }
+    for (mbglIndex i=0; i<nedges; ++i) {
+        mbglIndex e = edges[i];
+        pos[e] = bin[sup[e]]++;
+        order[pos[e]] = e;
+    }
+    for (mbglDegreeType d=max_sup+1; d>0; --d) { bin[d] = bin[d-1]; }
+    bin[0] = 0;
+
+    std::vector<char> removed(nz);
+    std::vector<mbglIndex> mark(nverts, nz);
+    for (mbglIndex i=0; i<nedges; ++i) {
+        mbglIndex e = order[i];
+        mbglDegreeType k_e = sup[e];
+        truss[e] = k_e + 2;
+        removed[e] = 1;
+        mbglIndex u = src[e], v = ja[e];
+        // mark the remaining edges at u by their canonical edge
+        for (mbglIndex k=ia[u]; k<ia[u+1]; ++k) {
+            mbglIndex w = ja[k];
+            if (w == u || rev[k] >= nz) { continue; }
+            mbglIndex f = fwd(u,w) ? k : rev[k];
+            if (!removed[f]) { mark[w] = f; }
+        }
+        for (mbglIndex k=ia[v]; k<ia[v+1]; ++k) {
+            mbglIndex w = ja[k];
+            if (w == v || mark[w] == nz || rev[k] >= nz) { continue; }
+            mbglIndex f = fwd(v,w) ? k : rev[k];
+            if (removed[f]) { continue; }
+            // the triangle (u,v,w) disappears with e
+            mbglIndex tri_edges[2] = {mark[w], f};
+            for (int j=0; j<2; ++j) {
+                mbglIndex x = tri_edges[j];
+                if (sup[x] > k_e) {
+                    // move x to the front of its bin and shrink the bin
+                    mbglDegreeType d = sup[x];
+                    mbglIndex px = pos[x], py = bin[d];
+                    mbglIndex y = order[py];
+                    if (x != y) {
+                        pos[x] = py; pos[y] = px;
+                        order[py] = x; order[px] = y;
+                    }
+                    ++bin[d];
+                    --sup[x];
+                }
+            }
+        }
+        for (mbglIndex k=ia[u]; k<ia[u+1]; ++k) { mark[ja[k]] = nz; }
+    }
+
+    for (mbglIndex i=0; i<nedges; ++i) {
+        mbglIndex e = edges[i];
+        if (rev[e] < nz) { truss[rev[e]] = truss[e]; }
+    }
+
+    return (0);
+}
 
 int dominator_tree(
     mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,
@@ -817,3 +2959,167 @@ int dominator_tree(
     return (0);
 }
 
+/** The workspace for the semi-NCA dominator tree algorithm.  All the
+ * arrays except vertex are indexed by the preorder number of a vertex.
+ */
+struct semi_nca_workspace
+{
+    semi_nca_workspace(mbglIndex n)
+        : pre(n), vertex(n), parent(n), semi(n), label(n), ancestor(n),
+          idom(n)
+    {}
+
+    std::vector<mbglIndex> pre, vertex, parent, semi, label, ancestor, idom;
+    std::vector<mbglIndex> stack, edge, path;
+};
+
+/** Compute the dominator tree from one root with the semi-NCA algorithm
+ * of Georgiadis and Tarjan.  
+ *
+ * The algorithm computes the semidominators as in Lengauer-Tarjan with
+ * simple path compression, and then finds the immediate dominator of 
+ * each vertex as the nearest common ancestor of its parent and its 
+ * semidominator in the partial dominator tree.
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex
+ * @param ia the row connectivity points into ja
+ * @param atj the predecessors of each vertex
+ * @param ati the row connectivity points into atj
+ * @param src the root vertex
+ * @param pred the immediate dominator of each vertex, pred[src] = src 
+ *   and pred[v] = v if v is not reachable from src
+ * @param w the workspace
+ */
+static void semi_nca_dominator_tree(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,
+    mbglIndex *atj, mbglIndex *ati, mbglIndex src, mbglIndex *pred,
+    semi_nca_workspace& w)
+{
+    const mbglIndex none = nverts;
+    for (mbglIndex v=0; v<nverts; ++v) { w.pre[v] = none; pred[v] = v; }
+
+    // number the vertices in a depth first preorder
+    mbglIndex nvisited = 0;
+    w.stack.clear(); w.edge.clear();
+    w.pre[src] = nvisited; w.vertex[nvisited] = src; w.parent[nvisited] = 0;
+    ++nvisited;
+    w.stack.push_back(src); w.edge.push_back(ia[src]);
+    while (!w.stack.empty()) {
+        mbglIndex u = w.stack.back();
+        mbglIndex& ei = w.edge.back();
+        if (ei == ia[u+1]) {
+            w.stack.pop_back(); w.edge.pop_back();
+            continue;
+        }
+        mbglIndex v = ja[ei++];
+        if (w.pre[v] != none) { continue; }
+        w.pre[v] = nvisited; w.vertex[nvisited] = v; 
+        w.parent[nvisited] = w.pre[u];
+        ++nvisited;
+        w.stack.push_back(v); w.edge.push_back(ia[v]);
+    }
+
+    for (mbglIndex i=0; i<nvisited; ++i) {
+        w.semi[i] = i; w.label[i] = i; w.ancestor[i] = none;
+    }
+
+    // compute the semidominators in reverse preorder
+    for (mbglIndex i=nvisited-1; i>0; --i) {
+        mbglIndex v = w.vertex[i];
+        for (mbglIndex ri=ati[v]; ri<ati[v+1]; ++ri) {
+            mbglIndex j = w.pre[atj[ri]];
+            if (j == none) { continue; }
+            // evaluate j with path compression
+            if (w.ancestor[j] != none) {
+                w.path.clear();
+                for (mbglIndex x=j; w.ancestor[w.ancestor[x]] != none; 
+                     x=w.ancestor[x]) 
+                {
+                    w.path.push_back(x);
+                }
+                for (size_t k=w.path.size(); k>0; --k) {
+                    mbglIndex x = w.path[k-1], a = w.ancestor[x];
+                    if (w.semi[w.label[a]] < w.semi[w.label[x]]) {
+                        w.label[x] = w.label[a];
+                    }
+                    w.ancestor[x] = w.ancestor[a];
+                }
+                j = w.label[j];
+            }
+            if (w.semi[j] < w.semi[i]) { w.semi[i] = w.semi[j]; }
+        }
+        w.ancestor[i] = w.parent[i];
+    }
+
+    // the immediate dominator is the nearest common ancestor of the 
+    // parent and the semidominator
+    w.idom[0] = 0;
+    for (mbglIndex i=1; i<nvisited; ++i) {
+        mbglIndex d = w.parent[i];
+        while (d > w.semi[i]) { d = w.idom[d]; }
+        w.idom[i] = d;
+        pred[w.vertex[i]] = w.vertex[d];
+    }
+}
+
+/** Compute the dominator trees from a set of roots
+ *
+ * This function uses the semi-NCA algorithm, which is usually faster 
+ * than Lengauer-Tarjan in practice.  Unlike dominator_tree, the 
+ * predecessors of each vertex are an input, so a caller that has the
+ * transpose of the graph does not pay to build it, and the transpose
+ * is shared by all the roots.  The roots are split among OpenMP 
+ * threads.
+ *
+ * @param nverts the number of vertices in the graph
+ * @param ja the connectivity for each vertex
+ * @param ia the row connectivity points into ja
+ * @param atj the connectivity for each vertex in the transposed graph
+ *   (optional)
+ * @param ati the row connectivity points into atj (optional).  If ati or
+ *   atj is NULL, the function builds the transpose once.
+ * @param nroots the number of roots
+ * @param roots the root vertices
+ * @param pred an nverts-by-nroots array in column major order with the 
+ *   immediate dominators for each root, pred[src] = src and pred[v] = v 
+ *   if v is not reachable from the root.
+ * @return an error code if possible
+ *   0: indicates success
+ *  -1: indicates a root is not a vertex
+ */
+int dominator_trees(
+    mbglIndex nverts, mbglIndex *ja, mbglIndex *ia,
+    mbglIndex *atj, mbglIndex *ati,
+    mbglIndex nroots, mbglIndex *roots, mbglIndex *pred)
+{
+    using namespace yasmic;
+    using namespace boost;
+
+    for (mbglIndex r=0; r<nroots; ++r) {
+        if (roots[r] >= nverts) { return (-1); }
+    }
+    if (nroots == 0) { return (0); }
+
+    std::vector<mbglIndex> ti, tj, tid;
+    if (!atj || !ati) {
+        typedef simple_csr_matrix<mbglIndex,double> crs_graph;
+        crs_graph g(nverts, nverts, ia[nverts], ia, ja, NULL);
+        ti.resize(nverts+1); tj.resize(ia[nverts]+1); tid.resize(ia[nverts]+1);
+        build_row_and_column_from_csr(g, &ti[0], &tj[0], &tid[0]);
+        ati = &ti[0]; atj = &tj[0];
+    }
+
+    #pragma omp parallel
+    {
+        semi_nca_workspace w(nverts);
+        #pragma omp for schedule(dynamic, 1)
+        for (ptrdiff_t r=0; r<(ptrdiff_t)nroots; ++r) {
+            semi_nca_dominator_tree(nverts, ja, ia, atj, ati, roots[r],
+                pred + (size_t)r*nverts, w);
+        }
+    }
+
+    return (0);
+}
+
@@ -277,6 +277,73 @@ namespace boost {
     }
   }
 
+  /**
+   * Run the shortest paths from one source and add the dependencies
+   * of that source to the vertex and edge centrality maps.  This is the
+   * body of the outer loop in Brandes' algorithm.
+   */
+  template<typename Graph, typename CentralityMap, typename EdgeCentralityMap,
+           typename IncomingMap, typename DistanceMap, 
+           typename DependencyMap, typename PathCountMap,
+           typename VertexIndexMap, typename ShortestPaths>
+  void 
+  brandes_accumulate_source(const Graph& g, 
+       typename graph_traits<Graph>::vertex_descriptor s,
+       CentralityMap centrality,
+       EdgeCentralityMap edge_centrality_map,
+       std::stack<typename graph_traits<Graph>::vertex_descriptor>& 
+         ordered_vertices,
+       IncomingMap incoming,
+       DistanceMap distance,
+       DependencyMap dependency,
+       PathCountMap path_count,
+       VertexIndexMap vertex_index,
+       ShortestPaths shortest_paths)
+  {
+    typedef typename boost::graph_traits<Graph>::vertex_iterator vertex_iterator;
+    typedef typename boost::graph_traits<Graph>::vertex_descriptor vertex_descriptor;
+
+    // Initialize for this iteration
+    vertex_iterator w, w_end;
+    for (tie(w, w_end) = vertices(g); w != w_end; ++w) {
+      incoming[*w].clear();
+      put(path_count, *w, 0);
+      put(dependency, *w, 0);
+    }
+    put(path_count, s, 1);
+    
+    // Execute the shortest paths algorithm. This will be either
+    // Dijkstra's algorithm or a customized breadth-first search,
+    // depending on whether the graph is weighted or unweighted.
+    shortest_paths(g, s, ordered_vertices, incoming, distance,
+                   path_count, vertex_index);
+    
+    while (!ordered_vertices.empty()) {
+      vertex_descriptor w = ordered_vertices.top();
+      ordered_vertices.pop();
+      
+      typedef typename property_traits<IncomingMap>::value_type
+        incoming_type;
+      typedef typename incoming_type::iterator incoming_iterator;
+      typedef typename property_traits<DependencyMap>::value_type 
+        dependency_type;
+      
+      for (incoming_iterator vw = incoming[w].begin();
+           vw != incoming[w].end(); ++vw) {
+        vertex_descriptor v = source(*vw, g);
+        dependency_type factor = dependency_type(get(path_count, v))
+          / dependency_type(get(path_count, w));
+        factor *= (dependency_type(1) + get(dependency, w));
+        put(dependency, v, get(dependency, v) + factor);
+        update_centrality(edge_centrality_map, *vw, factor);
+      }
+      
+      if (w != s) {
+        update_centrality(centrality, w, get(dependency, w));
+      }
+    }
+  }
+
   template<typename Graph, typename CentralityMap, typename EdgeCentralityMap,
            typename IncomingMap, typename DistanceMap, 
            typename DependencyMap, typename PathCountMap,
@@ -303,45 +370,10 @@ namespace boost {
     std::stack<vertex_descriptor> ordered_vertices;
     vertex_iterator s, s_end;
     for (tie(s, s_end) = vertices(g); s != s_end; ++s) {
-      // Initialize for this iteration
-      vertex_iterator w, w_end;
-      for (tie(w, w_end) = vertices(g); w != w_end; ++w) {
-        incoming[*w].clear();
-        put(path_count, *w, 0);
-        put(dependency, *w, 0);
-      }
-      put(path_count, *s, 1);
-      
-      // Execute the shortest paths algorithm. This will be either
-      // Dijkstra's algorithm or a customized breadth-first search,
-      // depending on whether the graph is weighted or unweighted.
-      shortest_paths(g, *s, ordered_vertices, incoming, distance,
-                     path_count, vertex_index);
-      
-      while (!ordered_vertices.empty()) {
-        vertex_descriptor w = ordered_vertices.top();
-        ordered_vertices.pop();
-        
-        typedef typename property_traits<IncomingMap>::value_type
-          incoming_type;
-        typedef typename incoming_type::iterator incoming_iterator;
-        typedef typename property_traits<DependencyMap>::value_type 
-          dependency_type;
-        
-        for (incoming_iterator vw = incoming[w].begin();
-             vw != incoming[w].end(); ++vw) {
-          vertex_descriptor v = source(*vw, g);
-          dependency_type factor = dependency_type(get(path_count, v))
-            / dependency_type(get(path_count, w));
-          factor *= (dependency_type(1) + get(dependency, w));
-          put(dependency, v, get(dependency, v) + factor);
-          update_centrality(edge_centrality_map, *vw, factor);
-        }
-        
-        if (w != *s) {
-          update_centrality(centrality, w, get(dependency, w));
-        }
-      }
+      brandes_accumulate_source(g, *s, centrality, edge_centrality_map,
+                                ordered_vertices, incoming, distance,
+                                dependency, path_count, vertex_index,
+                                shortest_paths);
     }
 
     typedef typename graph_traits<Graph>::directed_category directed_category;
@@ -403,6 +435,230 @@ brandes_betweenness_centrality(const Graph& g,
                                                      shortest_paths);
 }
 
+  // When the edge centrality map is a dummy property map, the threads
+  // do not need an edge accumulator.
+  template<typename T, typename EdgeIndexMap>
+  inline dummy_property_map 
+  make_local_centrality_map(std::vector<T>&, std::size_t, EdgeIndexMap, 
+                            dummy_property_map) 
+  { return dummy_property_map(); }
+
+  template<typename T, typename EdgeIndexMap, typename CentralityMap>
+  inline iterator_property_map<typename std::vector<T>::iterator, EdgeIndexMap>
+  make_local_centrality_map(std::vector<T>& local, std::size_t n, 
+                            EdgeIndexMap edge_index, CentralityMap)
+  { 
+    local.resize(n, T(0));
+    return make_iterator_property_map(local.begin(), edge_index);
+  }
+
+  template<typename Iter, typename EdgeIndexMap, typename T>
+  inline void 
+  reduce_centrality_map(std::pair<Iter, Iter>, EdgeIndexMap, 
+                        const std::vector<T>&, dummy_property_map) { }
+
+  template<typename Iter, typename IndexMap, typename T, 
+           typename CentralityMap>
+  inline void
+  reduce_centrality_map(std::pair<Iter, Iter> keys, IndexMap index,
+                        const std::vector<T>& local, 
+                        CentralityMap centrality_map)
+  {
+    while (keys.first != keys.second) {
+      update_centrality(centrality_map, *keys.first, 
+                        local[get(index, *keys.first)]);
+      ++keys.first;
+    }
+  }
+
+  // When the squared dependency map is a dummy property map, nothing
+  // is accumulated.
+  template<typename Graph, typename Vertex, typename DependencyMap>
+  inline void
+  accumulate_squared_dependency(const Graph&, Vertex, DependencyMap,
+                                dummy_property_map) { }
+
+  // Otherwise, add the square of the dependency of each vertex on the
+  // source s, which is the sample variance term for sampled centrality.
+  template<typename Graph, typename Vertex, typename DependencyMap,
+           typename SquaredMap>
+  inline void
+  accumulate_squared_dependency(const Graph& g, Vertex s, 
+                                DependencyMap dependency, 
+                                SquaredMap squared_map)
+  {
+    typedef typename boost::graph_traits<Graph>::vertex_iterator vertex_iterator;
+    vertex_iterator w, w_end;
+    for (tie(w, w_end) = vertices(g); w != w_end; ++w) {
+      if (*w != s) {
+        update_centrality(squared_map, *w, 
+                          get(dependency, *w)*get(dependency, *w));
+      }
+    }
+  }
+
+  /**
+   * Add the dependencies of the sources first[0], ..., first[nsources-1]
+   * to the centrality maps with the sources distributed among OpenMP 
+   * threads.  Each thread has its own stack, incoming lists, distances, 
+   * dependencies, and path counts, and accumulates the centrality in 
+   * its own vectors, which are summed at the end.  The path counts are
+   * stored as the centrality type so they do not overflow on large 
+   * graphs.  If squared_centrality is not a dummy map, it accumulates 
+   * the sum of the squared dependencies for each vertex.
+   */
+  template<typename Graph, typename SourceIterator, 
+           typename CentralityMap, typename SquaredCentralityMap, 
+           typename EdgeCentralityMap,
+           typename VertexIndexMap, typename EdgeIndexMap, 
+           typename ShortestPaths>
+  void 
+  parallel_brandes_accumulate_sources(const Graph& g, 
+                                      SourceIterator first,
+                                      std::ptrdiff_t nsources,
+                                      CentralityMap centrality,
+                                      SquaredCentralityMap squared_centrality,
+                                      EdgeCentralityMap edge_centrality_map,
+                                      VertexIndexMap vertex_index,
+                                      EdgeIndexMap edge_index,
+                                      ShortestPaths shortest_paths)
+  {
+    typedef typename boost::graph_traits<Graph>::vertex_descriptor vertex_descriptor;
+    typedef typename boost::graph_traits<Graph>::edge_descriptor edge_descriptor;
+    typedef typename property_traits<CentralityMap>::value_type 
+      centrality_type;
+    typedef typename mpl::if_c<(is_same<EdgeCentralityMap, 
+                                        dummy_property_map>::value),
+      dummy_property_map,
+      iterator_property_map<typename std::vector<centrality_type>::iterator,
+                            EdgeIndexMap> >::type local_edge_map_type;
+    typedef typename mpl::if_c<(is_same<SquaredCentralityMap, 
+                                        dummy_property_map>::value),
+      dummy_property_map,
+      iterator_property_map<typename std::vector<centrality_type>::iterator,
+                            VertexIndexMap> >::type local_squared_map_type;
+
+    std::size_t V = num_vertices(g);
+    std::size_t E = num_edges(g);
+
+    #pragma omp parallel
+    {
+      std::stack<vertex_descriptor> ordered_vertices;
+      std::vector<std::vector<edge_descriptor> > incoming(V);
+      std::vector<centrality_type> distance(V);
+      std::vector<centrality_type> dependency(V);
+      std::vector<centrality_type> path_count(V);
+      std::vector<centrality_type> local_centrality(V, centrality_type(0));
+      std::vector<centrality_type> local_squared_centrality;
+      std::vector<centrality_type> local_edge_centrality;
+      local_squared_map_type local_squared_centrality_map =
+        make_local_centrality_map(local_squared_centrality, V, vertex_index,
+                                  squared_centrality);
+      local_edge_map_type local_edge_centrality_map =
+        make_local_centrality_map(local_edge_centrality, E, edge_index,
+                                  edge_centrality_map);
+
+      #pragma omp for schedule(dynamic, 16)
+      for (std::ptrdiff_t i = 0; i < nsources; ++i) {
+        vertex_descriptor s = *(first + i);
+        brandes_accumulate_source(g, s,
+          make_iterator_property_map(local_centrality.begin(), vertex_index),
+          local_edge_centrality_map,
+          ordered_vertices,
+          make_iterator_property_map(incoming.begin(), vertex_index),
+          make_iterator_property_map(distance.begin(), vertex_index),
+          make_iterator_property_map(dependency.begin(), vertex_index),
+          make_iterator_property_map(path_count.begin(), vertex_index),
+          vertex_index, shortest_paths);
+        accumulate_squared_dependency(g, s,
+          make_iterator_property_map(dependency.begin(), vertex_index),
+          local_squared_centrality_map);
+      }
+
+      #pragma omp critical
+      {
+        reduce_centrality_map(vertices(g), vertex_index, local_centrality,
+                              centrality);
+        reduce_centrality_map(vertices(g), vertex_index, 
+                              local_squared_centrality, squared_centrality);
+        reduce_centrality_map(edges(g), edge_index, local_edge_centrality,
+                              edge_centrality_map);
+      }
+    }
+  }
+
+  /**
+   * Brandes' algorithm with the sources distributed among OpenMP threads.
+   * The graph must support random access to its vertices and an edge 
+   * index map.
+   */
+  template<typename Graph, typename CentralityMap, typename EdgeCentralityMap,
+           typename VertexIndexMap, typename EdgeIndexMap, 
+           typename ShortestPaths>
+  void 
+  parallel_brandes_betweenness_centrality_impl(const Graph& g, 
+                                      CentralityMap centrality,     // C_B
+                                      EdgeCentralityMap edge_centrality_map,
+                                      VertexIndexMap vertex_index,
+                                      EdgeIndexMap edge_index,
+                                      ShortestPaths shortest_paths)
+  {
+    // Initialize centrality
+    init_centrality_map(vertices(g), centrality);
+    init_centrality_map(edges(g), edge_centrality_map);
+
+    parallel_brandes_accumulate_sources(g, vertices(g).first, 
+                                        (std::ptrdiff_t)num_vertices(g),
+                                        centrality, dummy_property_map(),
+                                        edge_centrality_map,
+                                        vertex_index, edge_index,
+                                        shortest_paths);
+
+    typedef typename graph_traits<Graph>::directed_category directed_category;
+    const bool is_undirected = 
+      is_convertible<directed_category*, undirected_tag*>::value;
+    if (is_undirected) {
+      divide_centrality_by_two(vertices(g), centrality);
+      divide_centrality_by_two(edges(g), edge_centrality_map);
+    }
+  }
+
+template<typename Graph, typename CentralityMap, typename EdgeCentralityMap,
+         typename VertexIndexMap, typename EdgeIndexMap>
+void 
+parallel_brandes_betweenness_centrality(const Graph& g, 
+                               CentralityMap centrality,     // C_B
+                               EdgeCentralityMap edge_centrality_map,
+                               VertexIndexMap vertex_index,
+                               EdgeIndexMap edge_index)
+{
+  brandes_unweighted_shortest_paths shortest_paths;
+
+  parallel_brandes_betweenness_centrality_impl(g, centrality, 
+                                               edge_centrality_map,
+                                               vertex_index, edge_index,
+                                               shortest_paths);
+}
+
+template<typename Graph, typename CentralityMap, typename EdgeCentralityMap,
+         typename VertexIndexMap, typename EdgeIndexMap, typename WeightMap>
+void 
+parallel_brandes_betweenness_centrality(const Graph& g, 
+                               CentralityMap centrality,     // C_B
+                               EdgeCentralityMap edge_centrality_map,
+                               VertexIndexMap vertex_index,
+                               EdgeIndexMap edge_index,
+                               WeightMap weight_map)
+{
+  brandes_dijkstra_shortest_paths<WeightMap>
+    shortest_paths(weight_map);
+
+  parallel_brandes_betweenness_centrality_impl(g, centrality, 
+                                               edge_centrality_map,
+                                               vertex_index, edge_index,
+                                               shortest_paths);
+}
+
   template<typename Graph, typename CentralityMap, typename EdgeCentralityMap,
            typename WeightMap, typename VertexIndexMap>
   void 
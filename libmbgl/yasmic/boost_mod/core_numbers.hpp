@@ -15,6 +15,8 @@
 #include <boost/pending/indirect_cmp.hpp>
 #include <boost/graph/breadth_first_search.hpp>
 #include <boost/iterator/reverse_iterator.hpp>
+#include <vector>
+#include <functional>
 
 /*
  *core_numbers
@@ -30,6 +32,12 @@
 //
 // 8 February 2008
 // Fixed headers and missing typename
+//
+// 19 October 2026
+// Added the indexed d-ary heap and integer bucket queues for the 
+// weighted case and the core_numbers_with_queue extension point
+// Fixed the weighted case so a vertex never drops below the core
+// number of a vertex that was already removed
 
 namespace boost {
 
@@ -131,9 +139,11 @@ namespace boost {
         }
         
         // the version for weighted graphs is a little different
-        template <typename Graph, typename CoreMap, 
-            typename EdgeWeightMap, typename MutableQueue,
-            typename Visitor>
+        // a vertex never drops below the core number of the vertex that
+        // removed its edge, which makes the result independent of the
+        // order of ties in the queue
+        template <typename Graph, typename CoreMap, typename EdgeWeightMap,
+            typename MutableQueue, typename Visitor>
         typename property_traits<CoreMap>::value_type
         core_numbers_impl(Graph& g, CoreMap c, EdgeWeightMap wm,
             MutableQueue& Q, Visitor vis)
@@ -155,7 +165,7 @@ namespace boost {
                     // if c[u] > c[v], then u is still in the graph,
                     if (get(c,u) > v_cn) {
                         // remove the edge
-                        put(c,u,get(c,u)-get(wm,*oi));
+                        put(c,u,(std::max)(v_cn,get(c,u)-get(wm,*oi)));
                         Q.update(u);
                     }
                 }
@@ -164,6 +174,182 @@ namespace boost {
             return (v_cn);
         }
         
+        // An indexed d-ary heap with the same interface as mutable_queue.
+        // The priority of each vertex is read from the key map, so
+        // callers change the key and then call update.  Ties are broken 
+        // by the vertex index to make the output deterministic.  A 
+        // 4-ary heap has half the depth of a binary heap and keeps the 
+        // children of a node in one cache line.
+        template <typename Value, typename KeyMap, typename IndexMap,
+            std::size_t Arity=4>
+        class indexed_d_ary_heap
+        {
+        public:
+            typedef std::size_t size_type;
+            
+            indexed_d_ary_heap(size_type n, KeyMap key, IndexMap index)
+                : _key(key), _index(index), _pos(n, none())
+            { _data.reserve(n); }
+            
+            bool empty() const { return _data.empty(); }
+            size_type size() const { return (size_type)_data.size(); }
+            const Value& top() const { return _data[0]; }
+            
+            void push(const Value& v) {
+                _data.push_back(v);
+                _pos[get(_index,v)] = (size_type)(_data.size()-1);
+                sift_up(_data.size()-1);
+            }
+            
+            void pop() {
+                _pos[get(_index,_data[0])] = none();
+                if (_data.size() > 1) {
+                    _data[0] = _data.back();
+                    _pos[get(_index,_data[0])] = 0;
+                    _data.pop_back();
+                    sift_down(0);
+                } else {
+                    _data.pop_back();
+                }
+            }
+            
+            // restore the heap after the key of v changed, ignoring
+            // values that are not in the heap
+            void update(const Value& v) {
+                size_type p = _pos[get(_index,v)];
+                if (p == none()) { return; }
+                sift_up(p);
+                sift_down(_pos[get(_index,v)]);
+            }
+            
+        private:
+            static size_type none() { return (size_type)(-1); }
+            
+            bool less(const Value& a, const Value& b) const {
+                if (get(_key,a) < get(_key,b)) { return true; }
+                if (get(_key,b) < get(_key,a)) { return false; }
+                return get(_index,a) < get(_index,b);
+            }
+            
+            void place(std::size_t i, const Value& v) {
+                _data[i] = v;
+                _pos[get(_index,v)] = (size_type)i;
+            }
+            
+            void sift_up(std::size_t i) {
+                Value v = _data[i];
+                while (i > 0) {
+                    std::size_t parent = (i-1)/Arity;
+                    if (!less(v, _data[parent])) { break; }
+                    place(i, _data[parent]);
+                    i = parent;
+                }
+                place(i, v);
+            }
+            
+            void sift_down(std::size_t i) {
+                Value v = _data[i];
+                std::size_t n = _data.size();
+                while (true) {
+                    std::size_t first = Arity*i+1;
+                    if (first >= n) { break; }
+                    std::size_t last = (std::min)(first+Arity, n);
+                    std::size_t best = first;
+                    for (std::size_t j=first+1; j<last; ++j) {
+                        if (less(_data[j], _data[best])) { best = j; }
+                    }
+                    if (!less(_data[best], v)) { break; }
+                    place(i, _data[best]);
+                    i = best;
+                }
+                place(i, v);
+            }
+            
+            KeyMap _key;
+            IndexMap _index;
+            std::vector<Value> _data;
+            std::vector<size_type> _pos;
+        };
+        
+        // A bucket queue for non-negative integer keys with the same 
+        // interface as mutable_queue.  Each bucket is a doubly linked 
+        // list through the vertex index, so update is O(1).  The keys 
+        // may drop below the current minimum in the weighted core 
+        // numbers, so update moves the minimum back when that happens.
+        template <typename Value, typename KeyMap, typename IndexMap>
+        class integer_bucket_queue
+        {
+        public:
+            typedef std::size_t size_type;
+            
+            integer_bucket_queue(size_type n, KeyMap key, IndexMap index)
+                : _key(key), _index(index), _size(0), _min(0),
+                  _values(n), _bucket(n), _next(n, none()), _prev(n, none())
+            {}
+            
+            bool empty() const { return _size == 0; }
+            size_type size() const { return _size; }
+            
+            const Value& top() {
+                while (_head[_min] == none()) { ++_min; }
+                return _values[_head[_min]];
+            }
+            
+            void push(const Value& v) {
+                size_type i = get(_index,v);
+                _values[i] = v;
+                insert(i, key_bucket(v));
+                ++_size;
+            }
+            
+            void pop() {
+                top();
+                size_type i = _head[_min];
+                remove(i);
+                _bucket[i] = none();
+                --_size;
+            }
+            
+            // move v to the bucket for its new key, ignoring values that
+            // are not in the queue
+            void update(const Value& v) {
+                size_type i = get(_index,v);
+                if (_bucket[i] == none()) { return; }
+                remove(i);
+                insert(i, key_bucket(v));
+            }
+            
+        private:
+            static size_type none() { return (size_type)(-1); }
+            
+            size_type key_bucket(const Value& v) const {
+                return (size_type)get(_key,v);
+            }
+            
+            void insert(size_type i, size_type b) {
+                if (b >= (size_type)_head.size()) { _head.resize(b+1, none()); }
+                _bucket[i] = b;
+                _prev[i] = none();
+                _next[i] = _head[b];
+                if (_next[i] != none()) { _prev[_next[i]] = i; }
+                _head[b] = i;
+                if (b < _min || _size == 0) { _min = b; }
+            }
+            
+            void remove(size_type i) {
+                size_type b = _bucket[i];
+                if (_prev[i] != none()) { _next[_prev[i]] = _next[i]; }
+                else { _head[b] = _next[i]; }
+                if (_next[i] != none()) { _prev[_next[i]] = _prev[i]; }
+            }
+            
+            KeyMap _key;
+            IndexMap _index;
+            size_type _size, _min;
+            std::vector<Value> _values;
+            std::vector<size_type> _head, _bucket, _next, _prev;
+        };
+        
         template <typename Graph, typename CoreMap, typename EdgeWeightMap,
             typename IndexMap, typename CoreNumVisitor>
         typename property_traits<CoreMap>::value_type 
@@ -314,6 +500,26 @@ namespace boost {
         return detail::core_numbers_dispatch(g,c,wm,vim,vis);
     }
     
+    // non-named parameter version for the weighted case with a 
+    // user supplied queue.  The queue must have the interface of 
+    // mutable_queue and read its priorities from the core map c.
+    // See detail::indexed_d_ary_heap and detail::integer_bucket_queue.
+    template <typename Graph, typename CoreMap, typename EdgeWeightMap,
+        typename VertexIndexMap, typename MutableQueue, 
+        typename CoreNumVisitor>
+    typename property_traits<CoreMap>::value_type
+    core_numbers_with_queue(Graph& g, CoreMap c, EdgeWeightMap wm, 
+        VertexIndexMap /* vim, Q has its own index */, MutableQueue& Q,
+        CoreNumVisitor vis)
+    {
+        detail::compute_in_degree_map(g,c,wm);
+        typename graph_traits<Graph>::vertex_iterator vi,vi_end;
+        for (tie(vi,vi_end) = vertices(g); vi!=vi_end; ++vi) { 
+            Q.push(*vi);
+        }
+        return detail::core_numbers_impl(g,c,wm,Q,vis);
+    }
+    
     // non-named parameter version for the weighted case
 //    template <typename Graph, typename CoreMap, typename EdgeWeightMap>
 //    typename property_traits<CoreMap>::value_type
@@ -149,57 +149,42 @@ namespace boost {
             //and additionally paths from source->sink
             //this improves especially graphcuts for segmentation, as most of the nodes have source/sink connects
             //but shouldn't have an impact on other maxflow problems (this is done in grow() anyway)
+            //the graph may have parallel edges, so every edge to the sink is used and a node only joins
+            //a search tree while it is still free, otherwise a node with capacity left from the source
+            //could be moved into the sink tree and that capacity would never be used
             out_edge_iterator ei, e_end;
             for(tie(ei, e_end) = out_edges(m_source, m_g); ei != e_end; ++ei){
               edge_descriptor from_source = *ei;
+              if(m_res_cap_map[from_source] <= 0){
+                continue;
+              }
               vertex_descriptor current_node = target(from_source, m_g);
               if(current_node == m_sink){
                 tEdgeVal cap = m_res_cap_map[from_source];
                 m_res_cap_map[from_source] = 0;
+                m_res_cap_map[m_rev_edge_map[from_source]] += cap;
                 m_flow += cap;
                 continue;
               }
-              edge_descriptor to_sink;
-              bool is_there=false;
-              {
-                out_edge_iterator cn_ei, cn_ei_end;
-                for (tie(cn_ei, cn_ei_end) = out_edges(current_node,m_g);
-                     cn_ei != cn_ei_end; ++cn_ei) {
-                  if (target(*ei,m_g) == m_sink) {
-                    is_there = true; 
-                    to_sink = *ei;
-                    break;
-                  }
+              out_edge_iterator cn_ei, cn_ei_end;
+              for(tie(cn_ei, cn_ei_end) = out_edges(current_node, m_g);
+                  cn_ei != cn_ei_end && m_res_cap_map[from_source] > 0; ++cn_ei){
+                edge_descriptor to_sink = *cn_ei;
+                if(target(to_sink, m_g) != m_sink || m_res_cap_map[to_sink] <= 0){
+                  continue;
                 }
+                BOOST_USING_STD_MIN();
+                tEdgeVal cap = min BOOST_PREVENT_MACRO_SUBSTITUTION(m_res_cap_map[from_source], m_res_cap_map[to_sink]);
+                //add stuff to flow and update residuals, the reverse edges are updated
+                //as in augment() so the residual graph stays consistent
+                m_res_cap_map[from_source] -= cap;
+                m_res_cap_map[m_rev_edge_map[from_source]] += cap;
+                m_res_cap_map[to_sink] -= cap;
+                m_res_cap_map[m_rev_edge_map[to_sink]] += cap;
+                m_flow += cap;
               }
-              if(is_there){
-                tEdgeVal cap_from_source = m_res_cap_map[from_source];
-                tEdgeVal cap_to_sink = m_res_cap_map[to_sink];
-                if(cap_from_source > cap_to_sink){
-                  set_tree(current_node, tColorTraits::black());
-                  add_active_node(current_node);
-                  set_edge_to_parent(current_node, from_source);
-                  m_dist_map[current_node] = 1;
-                  m_time_map[current_node] = 1;
-                  //add stuff to flow and update residuals
-                  //we dont need to update reverse_edges, as incoming/outgoing edges to/from source/sink don't count for max-flow
-                  m_res_cap_map[from_source] -= cap_to_sink;
-                  m_res_cap_map[to_sink] = 0;
-                  m_flow += cap_to_sink;
-                } else if(cap_to_sink > 0){
-                  set_tree(current_node, tColorTraits::white());
-                  add_active_node(current_node);
-                  set_edge_to_parent(current_node, to_sink);
-                  m_dist_map[current_node] = 1;
-                  m_time_map[current_node] = 1;
-                  //add stuff to flow and update residuals
-                  //we dont need to update reverse_edges, as incoming/outgoing edges to/from source/sink don't count for max-flow
-                  m_res_cap_map[to_sink] -= cap_from_source;
-                  m_res_cap_map[from_source] = 0;
-                  m_flow += cap_from_source;
-                }
-              } else if(m_res_cap_map[from_source]){
-                //there is no sink connect, so we can't augment this path
+              if(m_res_cap_map[from_source] > 0 && get_tree(current_node) == tColorTraits::gray()){
+                //there is no sink connect left, so we can't augment this path
                 //but to avoid adding m_source to the active nodes, we just activate this node and set the approciate things
                 set_tree(current_node, tColorTraits::black());
                 set_edge_to_parent(current_node, from_source);
@@ -208,10 +193,11 @@ namespace boost {
                 add_active_node(current_node);
               }
             }
+            //a node with capacity left to the sink has no capacity left from the source now
             for(tie(ei, e_end) = out_edges(m_sink, m_g); ei != e_end; ++ei){
               edge_descriptor to_sink = m_rev_edge_map[*ei];
               vertex_descriptor current_node = source(to_sink, m_g);
-              if(m_res_cap_map[to_sink]){
+              if(m_res_cap_map[to_sink] > 0 && get_tree(current_node) == tColorTraits::gray()){
                 set_tree(current_node, tColorTraits::white());
                 set_edge_to_parent(current_node, to_sink);
                 m_dist_map[current_node] = 1;
@@ -417,11 +403,11 @@ namespace boost {
                   for(tie(ei, e_end) = out_edges(current_node, m_g); ei != e_end; ++ei){
                     edge_descriptor in_edge = m_rev_edge_map[*ei];
                     vertex_descriptor other_node = source(in_edge, m_g);
-                    if(get_tree(other_node) == tColorTraits::black() && has_parent(other_node)){
+                    if(get_tree(other_node) == tColorTraits::black() && other_node != m_source){
                       if(m_res_cap_map[in_edge] > 0){
                         add_active_node(other_node);
                       }
-                      if(source(get_edge_to_parent(other_node), m_g) == current_node){
+                      if(has_parent(other_node) && source(get_edge_to_parent(other_node), m_g) == current_node){
                         //we are the parent of that node
                         //it has to find a new parent, too
                         set_no_parent(other_node);
@@ -458,11 +444,11 @@ namespace boost {
                   for(tie(ei, e_end) = out_edges(current_node, m_g); ei != e_end; ++ei){
                     const edge_descriptor out_edge = *ei;
                     const vertex_descriptor other_node = target(out_edge, m_g);
-                    if(get_tree(other_node) == tColorTraits::white() && has_parent(other_node)){ 
+                    if(get_tree(other_node) == tColorTraits::white() && other_node != m_sink){ 
                       if(m_res_cap_map[out_edge] > 0){
                         add_active_node(other_node);
                       }
-                      if(target(get_edge_to_parent(other_node), m_g) == current_node){
+                      if(has_parent(other_node) && target(get_edge_to_parent(other_node), m_g) == current_node){
                         //we were it's parent, so it has to find a new one, too
                         set_no_parent(other_node);
                         m_child_orphans.push(other_node);
@@ -487,6 +473,9 @@ namespace boost {
               if(!has_parent(v) && v != m_source && v != m_sink){ //if it has no parent, this node can't be active(if its not source or sink)
                 m_active_nodes.pop();
                 m_in_active_list_map[v] = false;
+                if(m_last_grow_vertex == v){
+                  m_last_grow_vertex = graph_traits<Graph>::null_vertex();
+                }
               } else{
                 assert(get_tree(v) == tColorTraits::black() || get_tree(v) == tColorTraits::white());
                 return v;
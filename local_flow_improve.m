@@ -0,0 +1,79 @@
+function [S cond] = local_flow_improve(A,set,varargin)
+% LOCAL_FLOW_IMPROVE Improve the conductance of a set with max flows
+%
+% [S cond] = local_flow_improve(A,set) returns a set S with a better 
+% conductance than the set of vertices in set for the undirected graph 
+% A.  The input set can be a list of vertices or a logical indicator, and
+% S is a logical indicator.  The vector cond is the conductance history, 
+% cond(1) is the conductance of the input set and cond(end) is the 
+% conductance of S, where the conductance of S is 
+%   sum(sum(A(S,~S)))/min(sum(p(S)),sum(p(~S)))
+% and p is the weight of each vertex, usually the degree.
+%
+% The 'flowimprove' method is the FlowImprove algorithm of Andersen and 
+% Lang, which finds a set that may include vertices outside the input 
+% set, and the 'mqi' method is the MQI algorithm of Lang and Rao, which 
+% only finds subsets of the input set.  Each iteration solves one max 
+% flow problem on A with terminal edges to the vertices.  libmbgl never 
+% builds a new graph for the iterations, and each max flow starts from 
+% the flow of the last one.
+%
+% This method works on undirected graphs with non-negative edge weights.
+%
+% ... = local_flow_improve(A,set,...) takes a set of
+% key-value pairs or an options structure.  See set_matlab_bgl_options
+% for the standard options. 
+%   options.method: the improvement method [{'flowimprove'} | 'mqi']
+%   options.p: the weight of each vertex, or [] for the degrees [{[]}]
+%   options.maxiter: the maximum number of max flow problems [{100}]
+%   options.fix_diag: remove any diagonal entries [0 | {1}]
+%
+% Note: the input to this function must be symmetric, so this function
+% ignores the 'notrans' default option and never transposes the input.
+%
+% Example:
+%    A = grid_graph(20,20); 
+%    set = 1:190; % the bottom half of the grid, with a dent
+%    [S cond] = local_flow_improve(A,set)
+%
+% See also MAX_FLOW, LOCAL_PAGERANK
+
+% David Gleich
+% Copyright, Stanford University, 2006-2008
+
+%% History
+%  2026-10-19: Initial version
+%%
+
+[trans check full2sparse] = get_matlab_bgl_options(varargin{:});
+if full2sparse && ~issparse(A), A = sparse(A); end
+if trans, end % no trans check
+
+options = struct('method', 'flowimprove', 'p', [], 'maxiter', 100, ...
+    'fix_diag', 1);
+options = merge_options(options, varargin{:});
+
+if options.fix_diag, A = A - diag(diag(A)); end
+if check
+    % the matrix must be symmetric with non-negative weights
+    check_matlab_bgl(A,struct('sym',1,'values',1,'noneg',1,'nodiag',1));
+end
+
+n = size(A,1);
+if ~islogical(set), lset = false(n,1); lset(set) = 1; set = lset; end
+p = options.p;
+if isempty(p), p = full(sum(A,2)); end
+
+switch lower(options.method)
+    case 'flowimprove'
+        mqi = 0;
+    case 'mqi'
+        mqi = 1;
+    otherwise
+        error('matlab_bgl:invalidParameter', ...
+            'method %s is not supported', options.method);
+end
+
+[S cond] = flow_improve_mex(A,full(double(set(:))),full(double(p(:))),...
+    mqi,options.maxiter);
+S = logical(S);
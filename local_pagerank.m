@@ -0,0 +1,53 @@
+function [x,set,cond,npushes] = local_pagerank(A,seeds,varargin)
+% LOCAL_PAGERANK Approximate a personalized PageRank vector with push steps
+%
+% x = local_pagerank(A,seeds) returns a sparse approximation to the 
+% personalized PageRank vector of the undirected graph A with the 
+% teleportation vector uniform over the vertices in seeds.  The vector 
+% solves x = alpha*P'*x + (1-alpha)*v where P is the random walk matrix,
+% the same as in PAGERANK.  The method is the push algorithm of 
+% Andersen, Chung, and Lang and only touches the vertices near the 
+% seeds.  It stops when the residual at each vertex u is less than 
+% eps*deg(u), and the number of push steps is at most 1/(eps*(1-alpha)).
+%
+% [x,set,cond] = local_pagerank(A,seeds) also returns the best sweep cut 
+% of x, that is, the set of the first k vertices sorted by x(u)/deg(u) 
+% with the smallest conductance cond.  The fourth output is the number of
+% push steps.
+%
+% ... = local_pagerank(A,seeds,...) takes a set of
+% key-value pairs or an options structure.  See set_matlab_bgl_options
+% for the standard options. 
+%   options.alpha: the probability of following an edge [{0.99}]
+%   options.eps: the tolerance on the residual [{1e-4}]
+%
+% Example:
+%    load graphs/dfs_example.mat
+%    A = A+A';
+%    [x,set,cond] = local_pagerank(A,1)
+%
+% See also PAGERANK
+
+% David Gleich
+% Copyright, Stanford University, 2006-2008
+
+%% History
+%  2026-10-19: Initial version
+%%
+
+[trans check full2sparse] = get_matlab_bgl_options(varargin{:});
+if full2sparse && ~issparse(A), A = sparse(A); end
+
+options = struct('alpha', 0.99, 'eps', 1e-4);
+options = merge_options(options,varargin{:});
+
+if check
+    check_matlab_bgl(A,struct('sym',1));
+    if any(seeds < 1) || any(seeds > size(A,1))
+        error('matlab_bgl:invalidParameter', 'the seeds must be vertices');
+    end
+end
+
+[i v set cond npushes] = local_pagerank_mex(A,full(double(seeds(:)))-1,...
+    options.alpha,options.eps,double(nargout > 1));
+x = sparse(i,1,v,size(A,1),1);
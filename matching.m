@@ -33,7 +33,11 @@ function [m,max_card_matching]=matching(A,varargin)
 %
 % The greedy and extra_greedy initial match options create maximal
 % matchings, which cannot be increased in size by adding edges and are at
-% least half the cardinality of the maximum matching.  The call 
+% least half the cardinality of the maximum matching.  The karp_sipser
+% option is also maximal and is usually within a fraction of a percent of
+% the maximum on sparse graphs, so the augmenting path search has little
+% left to do.  The parallel_greedy option matches edges with random
+% priorities in rounds that are split among OpenMP threads.  The call 
 % [m,v] = matching(A,struct('augmenting_path','none')) computes a maximal
 % matching and sets v = 1 if the matching is maximum too.  
 %
@@ -42,12 +46,24 @@ function [m,max_card_matching]=matching(A,varargin)
 % The runtime is O(mn*alpha(m,n)).  The alpha function is the inverse
 % Ackermann function and is <= 4 for all valid Matlab inputs.
 %
+% For bipartite graphs, the call 
+% matching(A,struct('augmenting_path','hopcroft_karp')) uses the
+% Hopcroft-Karp algorithm, which runs in O(m sqrt(n)) time and splits each
+% phase among OpenMP threads.  It ignores the initial_match option, always
+% returns a maximum matching, and throws an error if the graph is not
+% bipartite.  The bipartition option gives the side of each vertex (0 or 1)
+% when it is known, e.g. for the graph spaugment(B,0) of a matrix B, and
+% then an edge between two vertices on the same side is an error.
+%
 % ...=matching(A,...) takes a set of
 % key-value pairs or an options structure.  See set_matlab_bgl_options
 % for the standard options. 
 %   options.initial_match: choice of initial matching 
-%     ['none' | 'greedy' | {'extra_greedy'}]
-%   options.augmenting_path: [{'edmonds'} | 'none']
+%     ['none' | 'greedy' | {'extra_greedy'} | 'karp_sipser' | 
+%      'parallel_greedy']
+%   options.augmenting_path: [{'edmonds'} | 'none' | 'hopcroft_karp']
+%   options.bipartition: the side of each vertex for hopcroft_karp 
+%     [{[]} | a vector of 0s and 1s]
 %   options.verify: verify output is maximum cardinality matching [0 | {1}]
 %   options.matrix_output: return the matching as a sparse matrix [{0} | 1]
 %
@@ -64,6 +80,8 @@ function [m,max_card_matching]=matching(A,varargin)
 %% History
 %  2007-07-08: Initial version
 %  2008-10-07: Changed options parsing
+%  2026-10-19: Added hopcroft_karp augmenting path option
+%  2026-10-19: Added karp_sipser and parallel_greedy initial matchings
 %%
 
 [trans check full2sparse] = get_matlab_bgl_options(varargin{:});
@@ -73,7 +91,7 @@ if trans, end % input must be symmetric, so no need to transpose
 options = struct('initial_match', 'extra_greedy', ...
     'augmenting_path', 'edmonds', ...
     'verify', 1, ...
-    'matrix_output', 0);
+    'matrix_output', 0, 'bipartition', []);
 options = merge_options(options, varargin{:});    
 
 if check, check_matlab_bgl(A,struct('sym',1)); end % make sure the matrix is symmetric
@@ -81,7 +99,8 @@ if check, check_matlab_bgl(A,struct('sym',1)); end % make sure the matrix is sym
 [m,max_card_matching] = matching_mex(A, ...
     options.verify, ...
     lower(options.initial_match), ...
-    lower(options.augmenting_path));
+    lower(options.augmenting_path), ...
+    double(options.bipartition(:)));
 
 if options.verify && ~max_card_matching && ...
         strcmpi(options.augmenting_path,'edmonds') && ...
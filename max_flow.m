@@ -2,7 +2,8 @@ function [flowval cut R F] = max_flow(A,u,v,varargin)
 % MAX_FLOW Compute the max flow on A from u to v.
 %
 % flowval=max_flow(A,u,v) computes the maximum flow on the network defined by
-% the adjacency structure A, with source u and sink v.
+% the adjacency structure A, with source u and sink v.  If u and v are 
+% sets of vertices, then the flow is from any vertex in u to any vertex in v.
 %
 % [flowval cut R F] = max_flow(A,u,v) returns the maximum flow in the 
 % network A with source u and sink v as well as additional information.  
@@ -14,22 +15,43 @@ function [flowval cut R F] = max_flow(A,u,v,varargin)
 %
 % The optional parameter algname specifies the algorithm used to compute
 % the maximum flow.  For reference, the push relabel method is likely the 
-% best general purpose algorithm.  
+% best general purpose algorithm.  The parallel_push_relabel algorithm 
+% uses multiple threads when libmbgl is compiled with OpenMP and computes 
+% the same flow value, but it may compute a different flow.  The dinic
+% algorithm is fast on unit capacity and bipartite networks.  The 
+% pseudoflow algorithm is Hochbaum's highest label pseudoflow algorithm,
+% which is often the fastest on large vision and segmentation networks.
 %
 % ... = max_flow(A,...) takes a set of
 % key-value pairs or an options structure.  See set_matlab_bgl_options
 % for the standard options. 
 %   options.algname: the max flow/min cut algorithm
-%     [{'push_relabel'} | 'edmunds_karp' | 'kolmogorov']
+%     [{'push_relabel'} | 'edmunds_karp' | 'kolmogorov' | 
+%      'parallel_push_relabel' | 'dinic' | 'pseudoflow']
 %   options.fix_diag: remove any diagonal entries [0 | {1}]
+%   options.integer_capacity: round the capacities down to integers 
+%     [0 | {1}], the edmunds_karp algorithm requires integer capacities
+%   options.source_capacity: the capacity of an edge from a super source 
+%     to each vertex [{[]} | a length n vector]
+%   options.sink_capacity: the capacity of an edge from each vertex to a 
+%     super sink [{[]} | a length n vector]
+%
+% The source_capacity and sink_capacity options add edges from a super 
+% source and to a super sink, which are also connected to the vertices in
+% u and v with edges that are never in a minimum cut.  Then u and v may be
+% empty.  These options are faster than adding vertices to A when 
+% computing many flows on the same graph with different terminals.
 %
 % Note: the values on A are interpreted as integers, please round them
 % yourself to get the best interpretation.  The code uses the floor of 
-% the values in A.
+% the values in A.  Set options.integer_capacity = 0 to use the values in
+% A without rounding.
 %
 % Example:
 %    load('graphs/max_flow_example.mat')
 %    max_flow(A,1,8)
+%    max_flow(A,1,[],struct('sink_capacity',ones(8,1))) % unit sink edges
+%    max_flow(A/3,1,8,struct('integer_capacity',0)) % no rounding
 
 % David Gleich
 % Copyright, Stanford University, 2006-2008
@@ -44,42 +66,54 @@ function [flowval cut R F] = max_flow(A,u,v,varargin)
 %  2008-09-23: Fixed "check" changing the input (Bug #273796)
 %  2008-10-07: Changed options parsing
 %    Added fix_diag option
+%  2026-10-19: Added sets of terminals and terminal capacities
+%    Switched to the flow network in libmbgl
+%    Added parallel_push_relabel
+%    Added dinic and integer_capacity option
+%    Added pseudoflow
 %%
 
 [trans check full2sparse] = get_matlab_bgl_options(varargin{:});
 if full2sparse && ~issparse(A), A = sparse(A); end
 
-options = struct('algname', 'push_relabel','fix_diag',1);
+options = struct('algname', 'push_relabel','fix_diag',1, ...
+    'source_capacity', [], 'sink_capacity', [], 'integer_capacity', 1);
 options = merge_options(options, varargin{:});
 
-% no negative capacities and no diagonal entries allowed
 if options.fix_diag, A = A - diag(diag(A)); end
-if check, check_matlab_bgl(A,struct('noneg',1,'nodiag',1)); end 
-
-% max_flow will transpose the data inside
+if check
+    % no negative capacities and no diagonal entries allowed
+    check_matlab_bgl(A,struct('noneg',1,'nodiag',1)); 
+    if any(options.source_capacity < 0) || any(options.sink_capacity < 0)
+        error('matlab_bgl:invalidParameter', ...
+            'the terminal capacities must be non-negative');
+    end
+end 
 
-% but ~trans means the input is already transposed, so pre-transpose
-if ~trans, A = A'; end
+% max_flow_mex uses the transpose of the network
+if trans, At = A'; else At = A; end
 
 n = size(A,1);
+args = {At,u,v,lower(options.algname)};
+if ~isempty(options.source_capacity) || ~isempty(options.sink_capacity) ...
+        || ~options.integer_capacity
+    args = [args {full(double(options.source_capacity(:))), ...
+        full(double(options.sink_capacity(:)))}];
+end
+if ~options.integer_capacity, args = [args {0}]; end
 
 if nargout == 2
-    [flowval cut] = max_flow_mex(A,u,v,lower(options.algname));
+    [flowval cut] = max_flow_mex(args{:});
 elseif nargout >= 3
-    [flowval cut ri rj rv] = max_flow_mex(A,u,v,lower(options.algname));
+    [flowval cut rv] = max_flow_mex(args{:});
     
-    % If anyone needs this operation to be more efficient, send me email, 
-    % and I can make max_flow_mex return this more efficiently.
-    R = sparse(ri,rj,rv,n,n);
-    if ~trans
-        R = R';
-    end
+    % rv is the residual of each non-zero of At
+    [ti tj] = find(At);
+    if trans, R = sparse(tj,ti,rv,n,n); else R = sparse(ti,tj,rv,n,n); end
 else
-    flowval = max_flow_mex(A,u,v,lower(options.algname));
+    flowval = max_flow_mex(args{:});
 end
 
 if nargout >= 4
     F = A - R;
 end
-
-
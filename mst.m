@@ -1,14 +1,19 @@
-function [out1 out2 out3] = mst(A,varargin)
+function [out1 out2 out3 out4] = mst(A,varargin)
 % MST Compute a minimum spanning tree for an undirected graph A.
 %
 % There are two ways to call MST.
 % T = mst(A)
 % [i j v] = mst(A) 
+% [i j v ei] = mst(A,struct('algname','filter_kruskal'))
 % The first call returns the minimum spanning tree T of A.  
 % The second call returns the set of edges in the minimum spanning tree.  
 % The calls are related by 
 %    T = sparse(i,j,v,size(A,1), size(A,1)); 
 %    T = T + T';
+% The third call also returns the index of each tree edge in the nonzeros
+% of A, so Av = nonzeros(A); v = Av(ei), or v = edge_weight(ei) with the
+% edge_weight option.  Only the 'filter_kruskal' algorithm computes this
+% output.
 % The optional algname parameter chooses which algorithm to use to compute
 % the minimum spanning tree.  Note that the set of edges returned is not
 % symmetric and the final graph must be explicitly symmetrized.
@@ -19,7 +24,7 @@ function [out1 out2 out3] = mst(A,varargin)
 % key-value pairs or an options structure.  See set_matlab_bgl_options
 % for the standard options. 
 %   options.algname: the minimum spanning tree algorithm
-%       ['prim' | {'kruskal'}]
+%       ['prim' | {'kruskal'} | 'boruvka' | 'filter_kruskal']
 %   options.edge_weight: a double array over the edges with an edge
 %       weight for each node, see EDGE_INDEX and EXAMPLES/REWEIGHTED_GRAPHS
 %       for information on how to use this option correctly, see Note 1.
@@ -31,6 +36,13 @@ function [out1 out2 out3] = mst(A,varargin)
 %       from Prim's algorithm [0 | {1}]; beware this option with the
 %       edge_weight option too.
 %
+% The 'boruvka' algorithm computes the minimum spanning forest in parallel
+% when MatlabBGL is compiled with OpenMP.  Ties between equal weights are
+% broken by vertex numbers, so the forest does not depend on the number of
+% threads.  The 'filter_kruskal' algorithm skips sorting heavy edges that
+% join already connected vertices and sorts in parallel with OpenMP.  It
+% returns the same forest as 'boruvka'.
+%
 % Note: the input to this function must be symmetric, so this function
 % ignores the 'notrans' default option and never transposes the input.
 %
@@ -63,6 +75,8 @@ function [out1 out2 out3] = mst(A,varargin)
 %  2007-12-14: Added rooted option for prim's algorithm
 %  2008-10-07: Changed options parsing
 %    Addressed issue with incorrect prim output and fixed matrix diagonal
+%  2026-10-19: Added boruvka algorithm
+%    Added filter_kruskal algorithm and the edge index output
 %%
 
 [trans check full2sparse] = get_matlab_bgl_options(varargin{:});
@@ -134,7 +148,11 @@ else
         'options.root is not ''none'' or a vertex number.');
 end
 
-[i j v] = mst_mex(A,lower(options.algname),edge_weight_opt,root);
+if nargout > 3
+    [i j v ei] = mst_mex(A,lower(options.algname),edge_weight_opt,root);
+else
+    [i j v] = mst_mex(A,lower(options.algname),edge_weight_opt,root);
+end
 
 % old temporary fix for disconnected graphs
 % if (num_components > 1)
@@ -158,6 +176,7 @@ else
     out1 = i; 
     out2 = j;
     out3 = v;
+    if nargout > 3, out4 = ei; end
 end;
 
 
@@ -0,0 +1,63 @@
+function [C labels value isolating] = multiway_cut(A,vs,varargin)
+% MULTIWAY_CUT Approximate a minimum multiway cut with isolating cuts
+%
+% [C labels value isolating] = multiway_cut(A,vs) returns a set of edges
+% C that disconnects all the terminal vertices vs from each other.  The 
+% non-zero values of C are the weights of the cut edges.  labels(u) = k 
+% if vertex u is on the side of terminal vs(k), value is the total weight
+% of the cut, and isolating(k) is the value of the minimum cut between 
+% vs(k) and all the other terminals.
+%
+% Each terminal takes the smallest side of its isolating cut, except the 
+% terminal with the largest isolating cut, which takes all the remaining
+% vertices.  The cut is within a factor of 2-2/length(vs) of the minimum 
+% multiway cut.  The isolating cuts share one flow network in libmbgl, 
+% and when libmbgl is compiled with OpenMP, they are solved at the same 
+% time.
+%
+% This method works on undirected graphs with non-negative edge weights.
+%
+% ... = multiway_cut(A,vs,...) takes a set of
+% key-value pairs or an options structure.  See set_matlab_bgl_options
+% for the standard options. 
+%   options.algname: the max flow algorithm
+%     [{'push_relabel'} | 'kolmogorov' | 'parallel_push_relabel' | 
+%      'dinic' | 'pseudoflow']
+%   options.fix_diag: remove any diagonal entries [0 | {1}]
+%
+% Note: the input to this function must be symmetric, so this function
+% ignores the 'notrans' default option and never transposes the input.
+%
+% Example:
+%    load('graphs/max_flow_example.mat')
+%    A = A + A';
+%    [C labels value] = multiway_cut(A,[1 4 8])
+%
+% See also MAX_FLOW, GOMORY_HU_TREE
+
+% David Gleich
+% Copyright, Stanford University, 2006-2008
+
+%% History
+%  2026-10-19: Initial version
+%%
+
+[trans check full2sparse] = get_matlab_bgl_options(varargin{:});
+if full2sparse && ~issparse(A), A = sparse(A); end
+if trans, end % no trans check
+
+options = struct('algname', 'push_relabel', 'fix_diag', 1);
+options = merge_options(options, varargin{:});
+
+if options.fix_diag, A = A - diag(diag(A)); end
+if check
+    % the matrix must be symmetric with non-negative weights
+    check_matlab_bgl(A,struct('sym',1,'values',1,'noneg',1,'nodiag',1));
+end
+
+[labels cut value isolating] = multiway_cut_mex(A,vs,lower(options.algname));
+
+n = size(A,1);
+[i j w] = find(A);
+cut = logical(cut);
+C = sparse(i(cut),j(cut),w(cut),n,n);
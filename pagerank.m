@@ -0,0 +1,101 @@
+function [x,niter,residual] = pagerank(A,varargin)
+% PAGERANK Compute the PageRank vector of a graph
+%
+% x = pagerank(A) returns the PageRank vector of the graph A.  The 
+% PageRank vector solves x = alpha*P'*x + (1-alpha)*v where 
+% P = diag(1./sum(A,2))*A is the random walk matrix.  A random walk at a 
+% dangling vertex (with no out-edges) jumps according to v.  The vector v
+% is uniform unless options.v is given, in which case x is the 
+% personalized PageRank vector for v.
+%
+% [x,niter,residual] = pagerank(A) also returns the number of iterations
+% and the L1 norm of the change in x at the last iteration.  The method 
+% stops when the residual is below options.tol or after options.maxiter 
+% iterations.
+%
+% The computation is the power method with a native multi-threaded 
+% sparse matrix-vector product on the transpose of A, so it does not 
+% form P or any temporary vectors in Matlab.  
+%
+% ... = pagerank(A,...) takes a set of
+% key-value pairs or an options structure.  See set_matlab_bgl_options
+% for the standard options. 
+%   options.alpha: the probability of following an edge [{0.85}]
+%   options.v: the teleportation vector, a non-negative vector that is
+%       normalized to sum to 1 [{[]} | length(n) double vector]
+%   options.tol: the tolerance on the L1 residual [{1e-8}]
+%   options.maxiter: the largest number of iterations [{1000}]
+%   options.unweighted: ignore the edge weights [{0} | 1]  
+%   options.edge_weight: a double array over the edges with an edge
+%       weight for each node, see EDGE_INDEX and EXAMPLES/REWEIGHTED_GRAPHS
+%       for information on how to use this option correctly
+%       [{'matrix'} | length(nnz(A)) double vector]
+%
+% Example:
+%    load graphs/padgett-florentine.mat
+%    x = pagerank(A)
+%    v = zeros(size(A,1),1); v(1) = 1;
+%    x = pagerank(A,struct('v',v))
+%
+% See also BETWEENNESS_CENTRALITY, CLOSENESS_CENTRALITY
+
+% David Gleich
+% Copyright, Stanford University, 2006-2008
+
+%% History
+%  2026-10-19: Initial version
+%%
+
+[trans check full2sparse] = get_matlab_bgl_options(varargin{:});
+if full2sparse && ~issparse(A), A = sparse(A); end
+
+options = struct('alpha', 0.85, 'v', [], 'tol', 1e-8, 'maxiter', 1000, ...
+    'unweighted', 0, 'edge_weight', 'matrix');
+options = merge_options(options,varargin{:});
+
+% edge_weights is an indicator that is 1 if we are using edge_weights
+% passed on the command line or 0 if we are using the matrix.
+edge_weights = 0;
+edge_weight_opt = 'matrix';
+
+if strcmp(options.edge_weight, 'matrix')
+    % do nothing if we are using the matrix weights
+else
+    edge_weights = 1;
+    edge_weight_opt = options.edge_weight;
+end
+
+if check
+    % check the values
+    if options.unweighted ~= 1 && edge_weights ~= 1
+        check_matlab_bgl(A,struct('values',1,'noneg',1));
+    else
+        check_matlab_bgl(A,struct());
+    end
+    if edge_weights && any(edge_weight_opt < 0)
+        error('matlab_bgl:invalidParameter', ...
+                'the edge_weight array must be non-negative');
+    end
+    if options.alpha < 0 || options.alpha >= 1
+        error('matlab_bgl:invalidParameter', ...
+                'alpha must be in [0,1)');
+    end
+    if ~isempty(options.v) && (any(options.v < 0) || sum(options.v) == 0)
+        error('matlab_bgl:invalidParameter', ...
+                'the teleportation vector must be non-negative and non-zero');
+    end
+end
+
+if trans
+    A = A';
+end
+
+weight_arg = options.unweighted;
+if ~weight_arg
+    weight_arg = edge_weight_opt;
+else
+    weight_arg = 0;
+end
+
+[x,niter,residual] = pagerank_mex(A,weight_arg,options.alpha,...
+    full(double(options.v(:))),options.tol,options.maxiter);
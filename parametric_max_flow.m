@@ -0,0 +1,69 @@
+function [flowvals cuts] = parametric_max_flow(A,sc,tc,varargin)
+% PARAMETRIC_MAX_FLOW Solve a sequence of max flow problems with monotone
+% terminal capacities
+%
+% flowvals=parametric_max_flow(A,sc,tc) computes the maximum flow in the
+% network defined by the adjacency structure A with an edge from a super
+% source to each vertex with capacity sc(:,k) and an edge from each vertex
+% to a super sink with capacity tc(:,k) for each column k.  The source 
+% capacities cannot decrease and the sink capacities cannot increase from 
+% one column to the next, that is, sc(:,k+1) >= sc(:,k) and 
+% tc(:,k+1) <= tc(:,k).  With these changes, the algorithm keeps the 
+% preflow of the push-relabel algorithm from one problem to the next 
+% (Gallo, Grigoriadis, and Tarjan), so each problem only pushes the new 
+% excess.  The labels are recomputed for each problem.  Neither A, sc, 
+% nor tc are rounded.
+%
+% [flowvals cuts] = parametric_max_flow(A,sc,tc) also returns the minimum
+% cut for each problem.  For each vertex on the source side of the k-th 
+% mincut, cuts(i,k) = 1, for each vertex on the sink side, cuts(i,k) = -1.
+% The source side of each cut is as large as possible, so the source sides
+% are nested, that is, cuts(:,k) == 1 implies cuts(:,k+1) == 1.
+%
+% ... = parametric_max_flow(A,...) takes a set of
+% key-value pairs or an options structure.  See set_matlab_bgl_options
+% for the standard options. 
+%   options.fix_diag: remove any diagonal entries [0 | {1}]
+%
+% Example:
+%    load('graphs/max_flow_example.mat')
+%    n = size(A,1); lambda = 0:0.5:3;
+%    sc = zeros(n,1); sc(1) = 1; sc = sc*lambda;
+%    tc = zeros(n,1); tc(8) = 10; tc = repmat(tc,1,length(lambda));
+%    parametric_max_flow(A,sc,tc)'
+
+% David Gleich
+% Copyright, Stanford University, 2006-2008
+
+%% History
+%  2026-10-19: Initial version
+%%
+
+[trans check full2sparse] = get_matlab_bgl_options(varargin{:});
+if full2sparse && ~issparse(A), A = sparse(A); end
+
+options = struct('fix_diag',1);
+options = merge_options(options, varargin{:});
+
+if options.fix_diag, A = A - diag(diag(A)); end
+if check
+    % no negative capacities and no diagonal entries allowed
+    check_matlab_bgl(A,struct('noneg',1,'nodiag',1)); 
+    if any(sc(:) < 0) || any(tc(:) < 0) || ...
+            any(any(diff(sc,1,2) < 0)) || any(any(diff(tc,1,2) > 0))
+        error('matlab_bgl:invalidParameter', ...
+            ['the terminal capacities must be non-negative, the source ' ...
+             'capacities cannot decrease, and the sink capacities cannot ' ...
+             'increase']);
+    end
+end 
+
+% parametric_max_flow_mex uses the transpose of the network
+if trans, At = A'; else At = A; end
+
+if nargout > 1
+    [flowvals cuts] = parametric_max_flow_mex(At,full(double(sc)),...
+        full(double(tc)));
+else
+    flowvals = parametric_max_flow_mex(At,full(double(sc)),full(double(tc)));
+end
@@ -10,6 +10,7 @@
  *  2007-02-22: Added edge centrality output
  *  2007-04-18: Updated to support additional 'weight' parameter
  *  2007-07-11: Fixed bug with weight parameter and non-zero length
+ *  2026-10-19: Added sampled approximate centrality
  */
 
 #include "mex.h"
@@ -43,6 +44,9 @@ void mexFunction(int nlhs, mxArray *plhs[],
     double *bc;
     double *ec;
 
+    /* approximation parameters */
+    double *approx;
+
     /* used to switch between algorithm types */
     int weight_type; /* = 0 if unweighted,
                         = 1 if a vector of weights,
@@ -54,14 +58,28 @@ void mexFunction(int nlhs, mxArray *plhs[],
      * where weight = 0 to use the unweighted version
      *       weight = 'matrix' to use the values in the matrix
      *       weight = vector to use a vector of weights
+     *
+     * or
+     * betweenness_centrality_mex(A,weight,approx)
+     * where approx = [epsilon delta samples seed] to estimate the
+     *       centrality from a sample of sources
      */
 
     const mxArray* arg_matrix;
     const mxArray* arg_weight;
 
-    if (nrhs != 2)
+    if (nrhs != 2 && nrhs != 3)
     {
-        mexErrMsgTxt("2 inputs required.");
+        mexErrMsgTxt("2 or 3 inputs required.");
+    }
+
+    approx = NULL;
+    if (nrhs == 3) {
+        if (!mxIsDouble(prhs[2]) || mxGetNumberOfElements(prhs[2]) != 4) {
+            mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+                "the approximation parameters must be a vector of length 4");
+        }
+        approx = mxGetPr(prhs[2]);
     }
 
     arg_matrix = prhs[0];
@@ -141,8 +159,18 @@ void mexFunction(int nlhs, mxArray *plhs[],
     mexPrintf("betweenness_centrality...");
     #endif
 
-    rval = betweenness_centrality(n, ja, ia, a,
-        bc, ec);
+    if (approx) {
+        rval = approximate_betweenness_centrality(n, ja, ia, a,
+            approx[0], approx[1], (mbglIndex)approx[2],
+            (unsigned int)approx[3], bc, ec, NULL);
+        if (rval == -1) {
+            mexErrMsgIdAndTxt("matlab_bgl:invalidParameter",
+                "invalid accuracy or number of samples");
+        }
+    } else {
+        rval = betweenness_centrality(n, ja, ia, a,
+            bc, ec);
+    }
 
     #ifdef _DEBUG
     mexPrintf("done, rval=%i\n", rval);
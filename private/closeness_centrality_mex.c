@@ -0,0 +1,159 @@
+/** @file closeness_centrality_mex.c
+ * @copyright Stanford University, 2006-2008
+ * @author David F. Gleich
+ * The mex interface to the libmbgl closeness_centrality and 
+ * top_k_closeness_centrality functions.
+ */
+
+/** History
+ *  2026-10-19: Initial version
+ */
+
+#include "mex.h"
+
+#if MX_API_VER < 0x07030000
+typedef int mwIndex;
+typedef int mwSize;
+#endif /* MX_API_VER */
+
+#include "matlab_bgl.h"
+
+#include "expand_macros.h"
+#include "common_functions.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+/*
+ * The mex function computes closeness or harmonic centrality.
+ */
+void mexFunction(int nlhs, mxArray *plhs[],
+                 int nrhs, const mxArray *prhs[])
+{
+    mwIndex mrows, ncols;
+
+    mwIndex n,nz;
+
+    /* sparse matrix */
+    mwIndex *ia, *ja;
+    double *a;
+
+    /* output data */
+    double *c;
+    double *topk;
+    double *nsearched;
+    mwIndex ns;
+
+    int harmonic;
+    mwIndex k;
+
+    /* used to switch between algorithm types */
+    int weight_type; /* = 0 if unweighted,
+                        = 1 if a vector of weights,
+                        = 2 if given by the matrix */
+
+    /*
+     * The current calling pattern is
+     * closeness_centrality_mex(A,weight,harmonic,k)
+     * where weight = 0 to use the unweighted version
+     *       weight = 'matrix' to use the values in the matrix
+     *       weight = vector to use a vector of weights
+     *       harmonic = 1 for harmonic centrality
+     *       k = 0 for all vertices, or the number of top vertices
+     */
+
+    const mxArray* arg_matrix;
+    const mxArray* arg_weight;
+    int required_arguments = 4;
+
+    if (nrhs != required_arguments) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "the function requires %i arguments, not %i\n",
+            required_arguments, nrhs);
+    }
+
+    arg_matrix = prhs[0];
+    arg_weight = prhs[1];
+
+    harmonic = (int)load_scalar_arg(prhs[2],2);
+    k = (mwIndex)load_scalar_arg(prhs[3],3);
+
+    if (mxGetNumberOfElements(arg_weight) == 1)
+    {
+        /* make sure it is valid */
+        if ((int)mxGetScalar(arg_weight) != 0) {
+            mexErrMsgIdAndTxt("matlab_bgl:invalidParameter",
+                "unknown weight option %g\n", mxGetScalar(arg_weight));
+        }
+
+        weight_type = 0;
+        a = NULL;
+    }
+    else if (mxIsChar(arg_weight)) {
+        weight_type = 2;
+        a = mxGetPr(arg_matrix);
+    }
+    else if (mxIsDouble(arg_weight)) {
+        weight_type = 1;
+        a = mxGetPr(arg_weight);
+    }
+    else {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidParameter",
+            "unrecognized weight option");
+        return;
+    }
+
+    /* The first input must be a sparse matrix. */
+    mrows = mxGetM(arg_matrix);
+    ncols = mxGetN(arg_matrix);
+    if (mrows != ncols || !mxIsSparse(arg_matrix) ||
+        ((!mxIsDouble(arg_matrix) || mxIsComplex(arg_matrix)) && (weight_type == 2))
+        )
+    {
+        mexErrMsgTxt("Input must be a square sparse matrix.");
+    }
+
+    n = mrows;
+
+    /* recall that we've transposed the matrix */
+    ja = mxGetIr(arg_matrix);
+    ia = mxGetJc(arg_matrix);
+
+    nz = ia[n];
+
+    /* check the reweighting array to make sure it is acceptable */
+    if (weight_type == 1 && mxGetNumberOfElements(arg_weight) < nz) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidParameter",
+            "the weight array must have length >= nnz(A)");
+    }
+
+    #ifdef _DEBUG
+    mexPrintf("closeness_centrality...");
+    #endif
+
+    if (k == 0) {
+        plhs[0] = mxCreateDoubleMatrix(n,1,mxREAL);
+        c = mxGetPr(plhs[0]);
+        closeness_centrality(n, ja, ia, a, harmonic, c);
+    } else {
+        if (k > n) { k = n; }
+        plhs[0] = mxCreateDoubleMatrix(k,1,mxREAL);
+        plhs[1] = mxCreateDoubleMatrix(k,1,mxREAL);
+        plhs[2] = mxCreateDoubleMatrix(1,1,mxREAL);
+        c = mxGetPr(plhs[0]);
+        topk = mxGetPr(plhs[1]);
+        nsearched = mxGetPr(plhs[2]);
+        top_k_closeness_centrality(n, ja, ia, a, harmonic, k,
+            (mwIndex*)topk, c, &ns);
+        expand_index_to_double((mwIndex*)topk, topk, k, 1.0);
+        *nsearched = (double)ns;
+    }
+
+    #ifdef _DEBUG
+    mexPrintf("done!\n");
+    #endif
+
+    #ifdef _DEBUG
+    mexPrintf("return\n");
+    #endif
+}
@@ -3,22 +3,38 @@ function compile(varargin)
 %  2008-04-01: Added check for pre Matlab 2006b for non-large dim 
 %              sparse matrices.
 %  2009-05-06: Added macosx-intel-64-large
+%  2026-10-19: Added OpenMP link flags and the -openmp, -noopenmp options
 %%
 
 debug = 0; if strmatch('-debug',varargin), debug=1; end
 verbose = 0; if strmatch('-verbose',varargin), verbose=1; end
+% link with OpenMP (not on Mac OS X unless -openmp), use -noopenmp when
+% libmbgl was compiled without it
+openmp = 1; if strmatch('-noopenmp',varargin), openmp=0; end
 clear mex
 
 mbglfiles = {'astar_search_mex.c', 'bfs_mex.c', 'dfs_mex.c', 'biconnected_components_mex.c', ...
          'components_mex.c', 'matlab_bgl_sp_mex.c', ...
          'matlab_bgl_all_sp_mex.c', ...
          'mst_mex.c', 'clustering_coefficients_mex.c', ...
+         'sampled_clustering_coefficients_mex.c', ...
          'betweenness_centrality_mex.c', ...
          'max_flow_mex.c', ...
+         'parametric_max_flow_mex.c', ...
+         'gomory_hu_tree_mex.c', ...
+         'multiway_cut_mex.c', ...
+         'flow_improve_mex.c', ...
+         'global_min_cut_mex.c', ...
          'bfs_dfs_vis_mex.c', ...
          'topological_order_mex.c', ...
          'matching_mex.c', ...
+         'weighted_matching_mex.c', ...
+         'closeness_centrality_mex.c', ...
          'core_numbers_mex.c', ...
+         'pagerank_mex.c', ...
+         'local_pagerank_mex.c', ...
+         'update_core_numbers_mex.c', ...
+         'triangles_mex.c', ...
          'dominator_tree_mex.c', ...
          'test_matching_mex.c', ...
          'path_from_pred_mex.c', ...
@@ -40,11 +56,14 @@ switch (computer)
         libname = 'mbgl-linux-32';
     case 'MAC'
         libname = 'mbgl-macosx-ppc-32';
+        openmp = openmp && ~isempty(strmatch('-openmp',varargin));
     case 'MACI'
         libname = 'mbgl-macosx-intel-32';
+        openmp = openmp && ~isempty(strmatch('-openmp',varargin));
     case 'MACI64'
         libname = 'mbgl-macosx-intel-64-large';
         large_arrays = 1;
+        openmp = openmp && ~isempty(strmatch('-openmp',varargin));
     case 'SOL2'
         solaris = 1;
         error('Not currently supported...\n');
@@ -93,6 +112,10 @@ elseif mac
 elseif isunix
     % 
     mexflags = [mexflags ' CFLAGS="\$CFLAGS -Wall" '];
+    if openmp
+        % the library's OpenMP code needs the OpenMP runtime
+        mexflags = [mexflags ' LDFLAGS="\$LDFLAGS -fopenmp" '];
+    end
     if solaris
     else
         mexflags = [mexflags '-I../libmbgl/include -L../libmbgl '];
@@ -8,6 +8,7 @@
  *  2007-07-08: Initial version
  *  2007-07-11: Updated for weighted cores
  *  2007-07-30: Added option for removal times
+ *  2026-10-19: Skip the removal times when they are not requested
  */
 
 #include "mex.h"
@@ -129,9 +130,10 @@ void mexFunction(int nlhs, mxArray *plhs[],
     #endif
 
     if (weight_type == 0) {
-        core_numbers(n, ja, ia, (mwIndex*)cn, (int*)rt);
+        /* without removal times, libmbgl uses the parallel algorithm */
+        core_numbers(n, ja, ia, (mwIndex*)cn, nlhs > 1 ? (int*)rt : NULL);
     } else {
-        weighted_core_numbers(n, ja, ia, a, cn, (int*)rt);
+        weighted_core_numbers(n, ja, ia, a, cn, nlhs > 1 ? (int*)rt : NULL);
     }
 
 
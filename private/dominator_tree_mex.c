@@ -11,6 +11,9 @@
 /*
  * 12 July 2007
  * Initial version
+ *
+ * 19 October 2026
+ * Added the semi-NCA call with a transpose and a set of roots
  */
 
 
@@ -52,21 +55,83 @@ void mexFunction(int nlhs, mxArray *plhs[],
      * The current calling pattern is
      * dominator_tree_mex(A,u)
      * u is the source vertex
+     * dominator_tree_mex(A,u,At)
+     * u is a vector of source vertices and At = A', this call uses 
+     * the semi-NCA algorithm
      */
     
     const mxArray* arg_matrix;
     const mxArray* arg_source;
     int required_arguments = 2;
     
-    if (nrhs != required_arguments) {
+    if (nrhs != required_arguments && nrhs != required_arguments+1) {
         mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
-            "the function requires %i arguments, not %i\n", 
-            required_arguments, nrhs);
+            "the function requires %i or %i arguments, not %i\n", 
+            required_arguments, required_arguments+1, nrhs);
     }
     
     arg_matrix = prhs[0];
     arg_source = prhs[1];
     
+    if (nrhs > required_arguments) {
+        mwIndex *roots;
+        mwIndex *ati, *atj;
+        mwIndex nroots, r;
+        double *rootpr;
+        
+        n = mxGetM(arg_matrix);
+        if (n != mxGetN(arg_matrix) || !mxIsSparse(arg_matrix) ||
+            mxGetM(prhs[2]) != n || mxGetN(prhs[2]) != n || 
+            !mxIsSparse(prhs[2])) {
+            mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+                "the matrices must be sparse, square, and the same size");
+        }
+        
+        /* recall that we've transposed the matrix, so the transpose 
+         * gives the predecessors of each vertex */
+        ja = mxGetIr(arg_matrix);
+        ia = mxGetJc(arg_matrix);
+        atj = mxGetIr(prhs[2]);
+        ati = mxGetJc(prhs[2]);
+        if (ati[n] != ia[n]) {
+            mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+                "the transpose must have the same number of non-zeros");
+        }
+        
+        nroots = mxGetNumberOfElements(arg_source);
+        rootpr = mxGetPr(arg_source);
+        roots = mxCalloc(nroots > 0 ? nroots : 1, sizeof(mwIndex));
+        for (r = 0; r < nroots; r++) {
+            if (rootpr[r] < 1 || rootpr[r] > n) {
+                mexErrMsgIdAndTxt("matlab_bgl:invalidMexParameter", 
+                    "start vertex (%g) not a valid vertex.", rootpr[r]);
+            }
+            roots[r] = (mwIndex)rootpr[r] - 1;
+        }
+        
+        plhs[0] = mxCreateDoubleMatrix(n,nroots,mxREAL);
+        pred = mxGetPr(plhs[0]);
+        
+        #ifdef _DEBUG
+        mexPrintf("dominator_trees...");
+        #endif 
+        
+        dominator_trees(n, ja, ia, atj, ati, nroots, roots, (mwIndex*)pred);
+        
+        #ifdef _DEBUG
+        mexPrintf("done\n");
+        #endif 
+        
+        /* expand the columns from the last to the first because the 
+         * indices may be smaller than the doubles */
+        for (r = nroots; r > 0; r--) {
+            expand_index_to_double_zero_equality(
+                ((mwIndex*)pred) + (r-1)*n, pred + (r-1)*n, n, 1.0);
+        }
+        
+        return;
+    }
+    
     u = (mwIndex)load_scalar_arg(arg_source,1);
     
     /* The first input must be a sparse matrix. */
@@ -0,0 +1,146 @@
+/** @file flow_improve_mex.c
+ * @copyright Stanford University, 2006-2008
+ * @author David F. Gleich
+ * The mex interface to the libmbgl FlowImprove and MQI function.
+ */
+
+/** History
+ *  2026-10-19: Initial version
+ */
+
+#include "mex.h"
+
+#if MX_API_VER < 0x07030000
+typedef int mwIndex;
+typedef int mwSize;
+#endif /* MX_API_VER */
+
+#include "matlab_bgl.h"
+#include "expand_macros.h"
+#include "common_functions.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * The mex function improves a set with FlowImprove or MQI.
+ */
+void mexFunction(int nlhs, mxArray *plhs[],
+                 int nrhs, const mxArray *prhs[])
+{
+    mwIndex mrows, ncols;
+
+    mwIndex n, i;
+
+    /* sparse matrix */
+    mwIndex *ia, *ja;
+    double *a;
+
+    /* parameters */
+    double *pset, *p;
+    int *set;
+    int mqi;
+    double dmaxiter;
+    mwIndex maxiter;
+    int rval;
+
+    /* result */
+    double *improved, *cond;
+    mwIndex niter;
+
+    /*
+     * The current calling pattern is
+     * flow_improve_mex(A,set,p,mqi,maxiter)
+     * where A is a symmetric matrix of edge weights, set is the indicator
+     * of the initial set, and p is the weight of each vertex.
+     * The outputs are [improved cond].
+     */
+
+    const mxArray* arg_matrix;
+    int required_arguments = 5;
+
+    if (nrhs != required_arguments) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "the function requires %i arguments, not %i\n",
+            required_arguments, nrhs);
+    }
+
+    arg_matrix = prhs[0];
+
+    mqi = (int)load_scalar_arg(prhs[3],3);
+    dmaxiter = load_scalar_arg(prhs[4],4);
+
+    /* The first input must be a sparse matrix. */
+    mrows = mxGetM(arg_matrix);
+    ncols = mxGetN(arg_matrix);
+    if (mrows != ncols ||
+        !mxIsSparse(arg_matrix) ||
+        !mxIsDouble(arg_matrix) ||
+        mxIsComplex(arg_matrix))
+    {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "the matrix must be sparse, square, and double valued");
+    }
+
+    n = mrows;
+
+    /* the matrix is symmetric, so the transpose is the same */
+    a = mxGetPr(arg_matrix);
+    ja = mxGetIr(arg_matrix);
+    ia = mxGetJc(arg_matrix);
+
+    if (!mxIsDouble(prhs[1]) || mxGetNumberOfElements(prhs[1]) != n ||
+        !mxIsDouble(prhs[2]) || mxGetNumberOfElements(prhs[2]) != n) 
+    {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "the set and the vertex weights must be double vectors of length %i",
+            (int)n);
+    }
+    if (dmaxiter < 0) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidParameter",
+            "maxiter must be non-negative");
+    }
+    maxiter = (mwIndex)dmaxiter;
+
+    pset = mxGetPr(prhs[1]);
+    p = mxGetPr(prhs[2]);
+    set = mxCalloc(n > 0 ? n : 1, sizeof(int));
+    for (i = 0; i < n; i++) { set[i] = pset[i] != 0; }
+
+    plhs[0] = mxCreateDoubleMatrix(n,1,mxREAL);
+    improved = mxGetPr(plhs[0]);
+    cond = mxCalloc(maxiter+1, sizeof(double));
+
+    #ifdef _DEBUG
+    mexPrintf("flow_improve...");
+    #endif
+
+    rval = flow_improve(n, ja, ia, a, p, set, mqi, maxiter,
+        (int*)improved, cond, &niter);
+    
+    #ifdef _DEBUG
+    mexPrintf("done!\n");
+    #endif
+
+    mxFree(set);
+
+    if (rval == -1) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidParameter",
+            "the vertex weights must be non-negative and both the set and "
+            "its complement must have positive weight");
+    } else if (rval != 0) {
+        mexErrMsgIdAndTxt("matlab_bgl:callFailed",
+            "the libmbgl call failed with rval=%i", rval);
+    }
+
+    expand_int_to_double((int*)improved, improved, n, 0.0);
+
+    plhs[1] = mxCreateDoubleMatrix(niter+1,1,mxREAL);
+    memcpy(mxGetPr(plhs[1]), cond, (niter+1)*sizeof(double));
+    mxFree(cond);
+
+    #ifdef _DEBUG
+    mexPrintf("return\n");
+    #endif
+}
@@ -0,0 +1,135 @@
+/** @file global_min_cut_mex.c
+ * @copyright Stanford University, 2006-2008
+ * @author David F. Gleich
+ * The mex interface to the libmbgl global minimum cut functions.
+ */
+
+/** History
+ *  2026-10-19: Initial version
+ */
+
+#include "mex.h"
+
+#if MX_API_VER < 0x07030000
+typedef int mwIndex;
+typedef int mwSize;
+#endif /* MX_API_VER */
+
+#include "matlab_bgl.h"
+#include "expand_macros.h"
+#include "common_functions.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * The mex function computes a global minimum cut.
+ */
+void mexFunction(int nlhs, mxArray *plhs[],
+                 int nrhs, const mxArray *prhs[])
+{
+    mwIndex mrows, ncols;
+
+    mwIndex n, i;
+
+    /* sparse matrix */
+    mwIndex *ia, *ja;
+    double *a;
+
+    /* parameters */
+    char *algname;
+    double dtrials, dseed;
+    int rval;
+
+    /* result */
+    double value;
+    double *cut;
+    int *side;
+
+    /*
+     * The current calling pattern is
+     * global_min_cut_mex(A,algname,ntrials,seed)
+     * where A is a symmetric matrix of edge weights and algname is 
+     * stoer_wagner or karger_stein.  The outputs are [value cut].
+     */
+
+    const mxArray* arg_matrix;
+    int required_arguments = 4;
+
+    if (nrhs != required_arguments) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "the function requires %i arguments, not %i\n",
+            required_arguments, nrhs);
+    }
+
+    arg_matrix = prhs[0];
+    algname = load_string_arg(prhs[1],1);
+    dtrials = load_scalar_arg(prhs[2],2);
+    dseed = load_scalar_arg(prhs[3],3);
+
+    /* The first input must be a sparse matrix. */
+    mrows = mxGetM(arg_matrix);
+    ncols = mxGetN(arg_matrix);
+    if (mrows != ncols ||
+        !mxIsSparse(arg_matrix) ||
+        !mxIsDouble(arg_matrix) ||
+        mxIsComplex(arg_matrix))
+    {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "the matrix must be sparse, square, and double valued");
+    }
+
+    n = mrows;
+    if (n < 2) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidParameter",
+            "the graph must have at least two vertices");
+    }
+    if (dtrials < 0 || dseed < 0) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidParameter",
+            "ntrials and seed must be non-negative");
+    }
+
+    /* the matrix is symmetric, so the transpose is the same */
+    a = mxGetPr(arg_matrix);
+    ja = mxGetIr(arg_matrix);
+    ia = mxGetJc(arg_matrix);
+
+    plhs[1] = mxCreateDoubleMatrix(n,1,mxREAL);
+    cut = mxGetPr(plhs[1]);
+    side = (int*)cut;
+
+    #ifdef _DEBUG
+    mexPrintf("global_min_cut...");
+    #endif
+
+    if (strcmp(algname,"stoer_wagner") == 0) {
+        rval = stoer_wagner_min_cut(n, ja, ia, a, &value, side);
+    } else if (strcmp(algname,"karger_stein") == 0) {
+        rval = karger_stein_min_cut(n, ja, ia, a, (mwIndex)dtrials,
+            (unsigned int)dseed, &value, side);
+    } else {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "algname option %s is invalid\n", 
+            algname);
+    }
+    
+    #ifdef _DEBUG
+    mexPrintf("done!\n");
+    #endif
+
+    if (rval != 0) {
+        mexErrMsgIdAndTxt("matlab_bgl:callFailed",
+            "the libmbgl call failed with rval=%i", rval);
+    }
+
+    /* the cut is 1 on one side and -1 on the other, like max_flow */
+    expand_int_to_double(side, cut, n, 0.0);
+    for (i = 0; i < n; i++) { cut[i] = cut[i] > 0 ? 1.0 : -1.0; }
+
+    plhs[0] = mxCreateDoubleScalar(value);
+
+    #ifdef _DEBUG
+    mexPrintf("return\n");
+    #endif
+}
@@ -0,0 +1,132 @@
+/** @file gomory_hu_tree_mex.c
+ * @copyright Stanford University, 2006-2008
+ * @author David F. Gleich
+ * The mex interface to the libmbgl Gomory-Hu tree function.
+ */
+
+/** History
+ *  2026-10-19: Initial version
+ */
+
+#include "mex.h"
+
+#if MX_API_VER < 0x07030000
+typedef int mwIndex;
+typedef int mwSize;
+#endif /* MX_API_VER */
+
+#include "matlab_bgl.h"
+#include "expand_macros.h"
+#include "common_functions.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * The mex function computes a Gomory-Hu cut tree.
+ */
+void mexFunction(int nlhs, mxArray *plhs[],
+                 int nrhs, const mxArray *prhs[])
+{
+    mwIndex mrows, ncols;
+
+    mwIndex n, ntree;
+
+    /* sparse matrix */
+    mwIndex *ia, *ja;
+    double *a;
+
+    /* algorithm name */
+    char *algname;
+    int algorithm;
+    int rval;
+
+    /* result */
+    double *ti, *tj, *tv;
+
+    /*
+     * The current calling pattern is
+     * gomory_hu_tree_mex(A,algname)
+     * where A is a symmetric matrix of edge weights and algname is the
+     * max flow algorithm.
+     */
+
+    const mxArray* arg_matrix;
+    int required_arguments = 2;
+
+    if (nrhs != required_arguments) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "the function requires %i arguments, not %i\n",
+            required_arguments, nrhs);
+    }
+
+    arg_matrix = prhs[0];
+    algname = load_string_arg(prhs[1],1);
+
+    /* The first input must be a sparse matrix. */
+    mrows = mxGetM(arg_matrix);
+    ncols = mxGetN(arg_matrix);
+    if (mrows != ncols ||
+        !mxIsSparse(arg_matrix) ||
+        !mxIsDouble(arg_matrix) ||
+        mxIsComplex(arg_matrix))
+    {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "the matrix must be sparse, square, and double valued");
+    }
+
+    n = mrows;
+
+    /* the matrix is symmetric, so the transpose is the same */
+    a = mxGetPr(arg_matrix);
+    ja = mxGetIr(arg_matrix);
+    ia = mxGetJc(arg_matrix);
+
+    if (strcmp(algname,"push_relabel") == 0) {
+        algorithm = 1;
+    } else if (strcmp(algname, "kolmogorov") == 0) {
+        algorithm = 3;
+    } else if (strcmp(algname, "parallel_push_relabel") == 0) {
+        algorithm = 4;
+    } else if (strcmp(algname, "dinic") == 0) {
+        algorithm = 5;
+    } else if (strcmp(algname, "pseudoflow") == 0) {
+        algorithm = 6;
+    } else {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "algname option %s is invalid\n", 
+            algname);
+    }
+
+    ntree = n > 0 ? n-1 : 0;
+    plhs[0] = mxCreateDoubleMatrix(ntree,1,mxREAL);
+    plhs[1] = mxCreateDoubleMatrix(ntree,1,mxREAL);
+    plhs[2] = mxCreateDoubleMatrix(ntree,1,mxREAL);
+    ti = mxGetPr(plhs[0]);
+    tj = mxGetPr(plhs[1]);
+    tv = mxGetPr(plhs[2]);
+
+    #ifdef _DEBUG
+    mexPrintf("gomory_hu_tree...");
+    #endif
+
+    rval = gomory_hu_tree(n, ja, ia, a, algorithm, 
+        (mwIndex*)ti, (mwIndex*)tj, tv);
+    
+    #ifdef _DEBUG
+    mexPrintf("done!\n");
+    #endif
+
+    if (rval != 0) {
+        mexErrMsgIdAndTxt("matlab_bgl:callFailed",
+            "the libmbgl call failed with rval=%i", rval);
+    }
+
+    expand_index_to_double((mwIndex*)ti, ti, ntree, 1.0);
+    expand_index_to_double((mwIndex*)tj, tj, ntree, 1.0);
+
+    #ifdef _DEBUG
+    mexPrintf("return\n");
+    #endif
+}
@@ -0,0 +1,155 @@
+/** @file local_pagerank_mex.c
+ * @copyright Stanford University, 2006-2008
+ * @author David F. Gleich
+ * The mex interface to the libmbgl local_pagerank function.
+ */
+
+/** History
+ *  2026-10-19: Initial version
+ */
+
+#include "mex.h"
+
+#if MX_API_VER < 0x07030000
+typedef int mwIndex;
+typedef int mwSize;
+#endif /* MX_API_VER */
+
+#include "matlab_bgl.h"
+
+#include "expand_macros.h"
+#include "common_functions.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+/*
+ * The mex function computes a local personalized PageRank vector.
+ */
+void mexFunction(int nlhs, mxArray *plhs[],
+                 int nrhs, const mxArray *prhs[])
+{
+    int rval;
+    mwIndex mrows, ncols;
+
+    mwIndex n;
+
+    /* sparse matrix */
+    mwIndex *ia, *ja;
+
+    /* parameters */
+    double alpha, eps, bound;
+    mwIndex nseeds, maxnz, i;
+    mwIndex *seeds;
+    double *seedvals;
+    int sweep;
+
+    /* output data */
+    mwIndex *pi;
+    double *pv;
+    mwIndex nnz, bestsize, npushes;
+    double bestcond;
+    double *xi, *xv, *set;
+
+    /*
+     * The current calling pattern is
+     * local_pagerank_mex(A,seeds,alpha,eps,sweep)
+     * where seeds are zero-based vertex indices
+     * and the outputs are [i v bestset bestcond npushes]
+     */
+
+    const mxArray* arg_matrix;
+    int required_arguments = 5;
+
+    if (nrhs != required_arguments) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "the function requires %i arguments, not %i\n",
+            required_arguments, nrhs);
+    }
+
+    arg_matrix = prhs[0];
+
+    alpha = load_scalar_arg(prhs[2],2);
+    eps = load_scalar_arg(prhs[3],3);
+    sweep = (int)load_scalar_arg(prhs[4],4);
+
+    /* The first input must be a sparse matrix. */
+    mrows = mxGetM(arg_matrix);
+    ncols = mxGetN(arg_matrix);
+    if (mrows != ncols || !mxIsSparse(arg_matrix))
+    {
+        mexErrMsgTxt("Input must be a square sparse matrix.");
+    }
+
+    n = mrows;
+
+    /* recall that we've transposed the matrix */
+    ja = mxGetIr(arg_matrix);
+    ia = mxGetJc(arg_matrix);
+
+    if (!mxIsDouble(prhs[1]) || mxGetNumberOfElements(prhs[1]) == 0) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "the seeds must be a non-empty double vector");
+    }
+    nseeds = mxGetNumberOfElements(prhs[1]);
+    seedvals = mxGetPr(prhs[1]);
+    seeds = mxCalloc(nseeds, sizeof(mwIndex));
+    for (i = 0; i < nseeds; i++) {
+        if (seedvals[i] < 0 || seedvals[i] >= n) {
+            mexErrMsgIdAndTxt("matlab_bgl:invalidParameter",
+                "seed vertex %g is out of range", seedvals[i]+1);
+        }
+        seeds[i] = (mwIndex)seedvals[i];
+    }
+
+    if (alpha < 0 || alpha >= 1 || eps <= 0) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidParameter",
+            "alpha must be in [0,1) and eps must be positive");
+    }
+
+    /* the number of pushes bounds the number of non-zeros */
+    bound = (double)nseeds + ceil(1.0/(eps*(1.0-alpha)));
+    maxnz = bound < (double)n ? (mwIndex)bound : n;
+
+    pi = mxCalloc(maxnz+1, sizeof(mwIndex));
+    pv = mxCalloc(maxnz+1, sizeof(double));
+
+    #ifdef _DEBUG
+    mexPrintf("local_pagerank...");
+    #endif
+
+    rval = local_pagerank(n, ja, ia, alpha, nseeds, seeds, eps,
+        maxnz, pi, pv, &nnz, sweep, &bestsize, &bestcond, &npushes);
+    if (rval != 0) {
+        mexErrMsgIdAndTxt("matlab_bgl:callFailed",
+            "the libmbgl call failed with rval=%i", rval);
+    }
+
+    #ifdef _DEBUG
+    mexPrintf("done!\n");
+    #endif
+
+    plhs[0] = mxCreateDoubleMatrix(nnz,1,mxREAL);
+    plhs[1] = mxCreateDoubleMatrix(nnz,1,mxREAL);
+    xi = mxGetPr(plhs[0]);
+    xv = mxGetPr(plhs[1]);
+    for (i = 0; i < nnz; i++) {
+        xi[i] = (double)pi[i] + 1.0;
+        xv[i] = pv[i];
+    }
+
+    if (nlhs > 2) {
+        if (!sweep) { bestsize = 0; bestcond = mxGetInf(); }
+        plhs[2] = mxCreateDoubleMatrix(bestsize,1,mxREAL);
+        set = mxGetPr(plhs[2]);
+        for (i = 0; i < bestsize; i++) {
+            set[i] = (double)pi[i] + 1.0;
+        }
+    }
+    if (nlhs > 3) { plhs[3] = mxCreateDoubleScalar(sweep ? bestcond : mxGetInf()); }
+    if (nlhs > 4) { plhs[4] = mxCreateDoubleScalar((double)npushes); }
+
+    #ifdef _DEBUG
+    mexPrintf("return\n");
+    #endif
+}
@@ -11,6 +11,10 @@
 /*
  * 8 July 2007
  * Initial version
+ *
+ * 19 October 2026
+ * Added the hopcroft_karp augmenting path option for bipartite graphs
+ * Added the karp_sipser and parallel_greedy initial matchings
  */
 
 
@@ -49,9 +53,13 @@ void mexFunction(int nlhs, mxArray *plhs[],
     int initial_match = 0;
     int augmenting_path = 0;
     
+    /* optional bipartition for hopcroft_karp */
+    int *side = NULL;
+    
     /* 
      * The current calling pattern is
      * matching_mex(A,verify,initial_match_name,augmenting_path_name)
+     * matching_mex(A,verify,initial_match_name,augmenting_path_name,side)
      */
     
     const mxArray* arg_matrix;
@@ -60,10 +68,10 @@ void mexFunction(int nlhs, mxArray *plhs[],
     const mxArray* arg_augmenting_path_name;    
     int required_arguments = 4;
     
-    if (nrhs != required_arguments) {
+    if (nrhs != required_arguments && nrhs != required_arguments+1) {
         mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
-            "the function requires %i arguments, not %i\n", 
-            required_arguments, nrhs);
+            "the function requires %i or %i arguments, not %i\n", 
+            required_arguments, required_arguments+1, nrhs);
     }
     
     arg_matrix = prhs[0];
@@ -103,6 +111,10 @@ void mexFunction(int nlhs, mxArray *plhs[],
         initial_match = 2;
     } else if (strcmp(initial_match_name,"extra_greedy") == 0) {
         initial_match = 3;
+    } else if (strcmp(initial_match_name,"karp_sipser") == 0) {
+        initial_match = 4;
+    } else if (strcmp(initial_match_name,"parallel_greedy") == 0) {
+        initial_match = 5;
     } else {
         mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
             "initial_match option %s is invalid\n", initial_match_name);
@@ -112,12 +124,27 @@ void mexFunction(int nlhs, mxArray *plhs[],
         augmenting_path = 1;
     } else if (strcmp(augmenting_path_alg_name,"edmonds") == 0) {
         augmenting_path = 2;
+    } else if (strcmp(augmenting_path_alg_name,"hopcroft_karp") == 0) {
+        augmenting_path = 3;
     } else {
         mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
             "augmenting_path_alg option %s is invalid\n", 
             augmenting_path_alg_name);
     }
     
+    if (nrhs > required_arguments && !mxIsEmpty(prhs[4])) {
+        mwIndex i;
+        double *sidepr;
+        if (mxGetNumberOfElements(prhs[4]) != n || !mxIsDouble(prhs[4])) {
+            mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+                "the bipartition must be a double vector with one entry "
+                "per vertex");
+        }
+        sidepr = mxGetPr(prhs[4]);
+        side = mxCalloc(n, sizeof(int));
+        for (i=0; i<n; i++) { side[i] = sidepr[i] != 0.0; }
+    }
+    
     plhs[0] = mxCreateDoubleMatrix(n,1,mxREAL);
     plhs[1] = mxCreateDoubleMatrix(1,1,mxREAL);
 
@@ -130,10 +157,29 @@ void mexFunction(int nlhs, mxArray *plhs[],
             initial_match_name, augmenting_path_alg_name,verify);
         #endif 
     
-        maximum_cardinality_matching(n, ja, ia, 
-            (mwIndex*)mxGetPr(plhs[0]),
-            initial_match, augmenting_path, verify,
-            &verified, &null_vertex);
+        if (augmenting_path == 3) {
+            /* hopcroft_karp makes its own initial matching, and the
+             * verification checks the whole graph like the other
+             * algorithms */
+            int rval = bipartite_matching(n, ja, ia, side,
+                (mwIndex*)mxGetPr(plhs[0]), &null_vertex);
+            if (rval == -2 && side) {
+                mexErrMsgIdAndTxt("matlab_bgl:invalidParameter",
+                    "the bipartition has an edge inside one side");
+            } else if (rval == -2) {
+                mexErrMsgIdAndTxt("matlab_bgl:invalidParameter",
+                    "the hopcroft_karp matching requires a bipartite graph");
+            }
+            if (verify > 1) {
+                test_maximum_cardinality_matching(n, ja, ia,
+                    (mwIndex*)mxGetPr(plhs[0]), &verified);
+            }
+        } else {
+            maximum_cardinality_matching(n, ja, ia, 
+                (mwIndex*)mxGetPr(plhs[0]),
+                initial_match, augmenting_path, verify,
+                &verified, &null_vertex);
+        }
         
         #ifdef _DEBUG
         mexPrintf("done!\n");
@@ -18,6 +18,12 @@
  * Added algname option and kolmogorov and edmunds interfaces
  *
  * 2008-04-02: Fix 1 for max-flow cut bug
+ *
+ * 2026-10-19: Switched to the libmbgl flow network and added sets of 
+ * terminals with terminal capacities
+ * 2026-10-19: Added parallel_push_relabel
+ * 2026-10-19: Added dinic and double capacities
+ * 2026-10-19: Added pseudoflow
  */
 
 #include "mex.h"
@@ -36,191 +42,6 @@ typedef int mwSize;
 #include <string.h>
 
 
-/**
- * The output matrix B has twice the number of non-zeros as A, it also 
- * row oriented, not column oriented.
- *
- * For each non-zero (i,j), we insert (i,j) with capacity a(i,j) and
- * (j,i) with capacity 0.
- *
- * @param n number of nodes in matrix a
- * @param pja the column pointer (length n+1)
- * @param ia the row array (length pja[n])
- * @param a the value array (length pja[n]), we floor these to integers in b
- * @param pib the row pointer for the new matrix b (length n+1)
- * @param jb the column array (length pib[n])
- * @param cb the capacity array (length pib[n])
- * @param rev_map the reverse edge map (length pib[n])
- */
-void build_matrix(mbglIndex n, mbglIndex *ia, mbglIndex *pja, double *a, mbglIndex **opib, mbglIndex **ojb, int **ocb,
-            mbglIndex **orev_map)
-{
-    mbglIndex i,j,k;
-    mbglIndex *pib, *jb, *rev_map;
-    int *cb;
-    
-    mbglIndex nz = pja[n];
-    
-    /* allocate the row pointer for the new matrix */
-    pib = mxCalloc(sizeof(mbglIndex),(n+1));
-    jb = mxCalloc(sizeof(mbglIndex),(2*nz));
-    cb = mxCalloc(sizeof(int),(2*nz));
-    rev_map = mxCalloc(sizeof(mbglIndex),(2*nz));   
-    
-    *opib = pib;
-    *ojb = jb;
-    *ocb = cb;
-    *orev_map = rev_map;
-    
-    for (j=0;j<n;j++)
-    {
-        for (k=pja[j];k<pja[j+1];k++)
-        {
-            i = ia[k];
-            
-            /* add the degree for each entry, */
-            pib[i+1]++;
-            pib[j+1]++;
-        }
-    }
-    
-    
-    
-    /* compute the starting locations for each row */
-    k=0;
-    for (i=1;i<n+1;i++)
-    {
-        k += pib[i];
-        pib[i] = k;
-    }
-    
-    
-    /* quick check... */
-    if (pib[n] != 2*nz)
-    {
-        mexErrMsgTxt("Error: number of non-zeros do not match");
-    }
-    
-    
-
-    /* now actually add all the data to the matrix */
-    for (j=0;j<n;j++)
-    {
-        for (k=pja[j];k<pja[j+1];k++)
-        {
-            i = ia[k];
-            
-            /* insert edge (i,j) */
-            jb[pib[i]] = j;
-            cb[pib[i]] = (int)floor(a[k]);
-            
-            /* insert edge (j,i) */
-            jb[pib[j]] = i;
-            cb[pib[j]] = 0;
-            
-            /* create reverse map */
-            rev_map[pib[i]] = pib[j];
-            rev_map[pib[j]] = pib[i];
-            
-            /* increment pointers */
-            pib[i]++;
-            pib[j]++;
-        }
-    }
-    
-    
-    /* now restore the correct value on the array, that is, shift it by one */
-    for (i=n;i>0;i--)
-    {
-        pib[i] = pib[i-1];
-    }
-    
-    pib[0] = 0;
-}
-
-/**
- * Convert the residual graph into a graph cut.
- * 
- * @param u the source vertex
- * @param n the number of nodes
- * @param pia the row pointer for the flow graph A
- * @param ja the column array for flow graph A
- * @param cap the capacity array for flow graph A
- * @param res the residual array for flow graph A
- * @param mincut the mincut array (output)
- */
-void build_cut(mbglIndex u, mbglIndex n, mbglIndex *pia, mbglIndex *ja, int *cap, int *res, int *mincut)
-{
-    mbglIndex k;
-    mbglIndex v, vn;
-    
-    mbglIndex *q;
-    mbglIndex qhead, qtail;
-    
-    /* initialize the mincut array to 0 */
-    memset(mincut, 0, sizeof(int)*n);
-    
-    /* 
-     * if mincut[i] == 0, then we haven't visited the vertex, 
-     * if mincut[i] != 0, then the vertex is visited or on the queue. 
-     */
-    
-    /* allocate the queue, it won't ever have more than n entries. */
-    q = mxCalloc(sizeof(mbglIndex), n);
-    qhead = 0; qtail = 0;
-    
-    /* add u to the queue */
-    mincut[u] = 1;
-    q[qtail] = u;
-    qtail++;
-    
-    while (qhead != qtail)
-    {
-        /* pop the queue */
-        v = q[qhead];
-        qhead++;
-        
-        /* look at all neighbors of v. */
-        for (k=pia[v]; k < pia[v+1]; k++)
-        {        
-            /* removed: 2008-04-02: if (cap[k] > 0 && res[k] > 0) */
-            if (res[k] > 0)
-            {
-                /* if res[k] > 0, then the edge is not saturated, so
-                 * we follow it find the cut.
-                 */
-                
-                /* get the current neighbor */
-                vn = ja[k];
-                
-                if (mincut[vn] == 0)
-                {
-                    /* add the vertex to the queue */
-                    mincut[vn] = 1;
-                    q[qtail] = vn;
-                    qtail++;
-                }
-            }
-        }
-    }
-    
-    /* at this point, we've visited all vertices reachable from 
-     * unsaturated edges. */
-    
-    for (k=0; k < n; k++)
-    {
-        if (mincut[k] == 0)
-        {
-            mincut[k] = -1;
-        }
-        
-        /* mexPrintf("mincut[%i] = %i\n", k, mincut[k]); */
-    }
-    
-    mxFree (q);
-}
-
-
 /** Check the cut identified against the flow value calculated.
  * 
  * Run through the edges and compute the sum of edges crossing the cut
@@ -229,31 +50,92 @@ void build_cut(mbglIndex u, mbglIndex n, mbglIndex *pia, mbglIndex *ja, int *cap
  * This function will flag issues with incorrect rounding.
  *
  * @param flow the computed flow value
- * @param pimincut the min cut vector (-1 for side 1, 1 for side 2)
- * @param n, ia, pja, a, the graph structure
+ * @param integer the capacities were rounded down to integers
+ * @param pimincut the min cut vector (1 for the source side, -1 for the 
+ *   sink side)
+ * @param n, ja, ia, a, the graph structure
+ * @param scap, tcap the terminal capacities (optional)
  */
-void test_cut(int flow, int* pimincut, 
-    mbglIndex n, mbglIndex *ia, mbglIndex *pja, double *a)
+void test_cut(double flow, int integer, int* pimincut, 
+    mbglIndex n, mbglIndex *ja, mbglIndex *ia, double *a,
+    double *scap, double *tcap)
 {
     double cv=0.0; 
     mbglIndex i, j, k;
-    for (j=0; j<n; j++) {
-        for (k=pja[j]; k<pja[j+1]; k++) {
-            i=ia[k];
+    for (i=0; i<n; i++) {
+        for (k=ia[i]; k<ia[i+1]; k++) {
+            j=ja[k];
             /* the source side is 1, and sink side is -1, so we get
              * a source to sink edge if cut[i]>cut[j]. */
             if (pimincut[i]>pimincut[j]) {
-                /* mexPrintf("%i -> %i : +%i\n", i+1,j+1,(int)a[k]); */
-                cv += a[k];
+                cv += integer ? floor(a[k]) : a[k];
             }
         }
+        if (scap && pimincut[i] < 0 && scap[i] > 0) { 
+            cv += integer ? floor(scap[i]) : scap[i]; 
+        }
+        if (tcap && pimincut[i] > 0 && tcap[i] > 0) { 
+            cv += integer ? floor(tcap[i]) : tcap[i]; 
+        }
     }
-    if ((int)cv != flow) {
+    if (integer && (int)cv != (int)flow) {
         mexWarnMsgIdAndTxt("max_flow_mex:cutValueNotFlowValue",
           "The rounded (unrounded) value of the minimum cut is %i (%g),"
           "but the value of the max-flow is %i.  These values should be equal",
-          (int)cv,cv,flow);
+          (int)cv,cv,(int)flow);
+    } else if (!integer && fabs(cv - flow) > 1e-8*(1.0 + fabs(flow))) {
+        mexWarnMsgIdAndTxt("max_flow_mex:cutValueNotFlowValue",
+          "The value of the minimum cut is %g,"
+          "but the value of the max-flow is %g.  These values should be equal",
+          cv,flow);
+    }
+}
+
+/** Load a set of terminal vertices.
+ *
+ * @param arg the vector of vertex numbers
+ * @param n the number of vertices
+ * @param argnum the argument number for errors
+ * @param nterminals the number of terminals (output)
+ * @return the zero-indexed terminals
+ */
+mbglIndex* load_terminals(const mxArray* arg, mbglIndex n, int argnum, 
+    mbglIndex *nterminals)
+{
+    mbglIndex i, nt = mxGetNumberOfElements(arg);
+    mbglIndex *terminals;
+    double *pr;
+    if (!mxIsDouble(arg)) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "the terminals in argument %i must be a double vector", argnum);
     }
+    pr = mxGetPr(arg);
+    terminals = mxCalloc(sizeof(mbglIndex), nt > 0 ? nt : 1);
+    for (i=0; i<nt; i++) {
+        if (pr[i] > n || pr[i] < 1) {
+            mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+                "invalid %s vertex: %g\n", argnum == 2 ? "source" : "sink",
+                pr[i]);
+        }
+        terminals[i] = (mbglIndex)pr[i] - 1;
+    }
+    *nterminals = nt;
+    return terminals;
+}
+
+/** Load an optional vector of terminal capacities.
+ *
+ * @return the capacities or NULL if the argument is empty
+ */
+double* load_terminal_capacities(const mxArray* arg, mbglIndex n, int argnum)
+{
+    if (mxIsEmpty(arg)) { return NULL; }
+    if (!mxIsDouble(arg) || mxIsSparse(arg) || mxGetNumberOfElements(arg) != n) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "argument %i must be a full double vector with one entry "
+            "per vertex", argnum);
+    }
+    return mxGetPr(arg);
 }
 
 /*
@@ -262,75 +144,70 @@ void test_cut(int flow, int* pimincut,
 void mexFunction(int nlhs, mxArray *plhs[],
                  int nrhs, const mxArray *prhs[])
 {
-    mbglIndex i,j,k;
-    
     mbglIndex mrows, ncols;
     
     mbglIndex n,nz;
     
     /* sparse matrix */
-    mwIndex *A_row, *A_col;
-    double *A_val;
+    mwIndex *ia, *ja;
+    double *a;
     
-    /* source/sink */
-    mbglIndex u, v;
+    /* terminals */
+    mbglIndex *sources, *sinks;
+    mbglIndex nsources, nsinks;
+    double *scap = NULL, *tcap = NULL;
     
     /* algorithm name */
     char *algname;
+    int algorithm;
+    int integer = 1;
     
-    /* flow matrix connectivity */
-    mbglIndex *pi_flow, *j_flow;
-    
-    /* capacity and residual structures */
-    int *cap, *res;
-    
-    /* reverse edge map */
-    mbglIndex *rev_edge_map;
+    /* the flow network */
+    flow_network *net;
+    int rval;
     
     /* result */
-    int flow;
-    
-    /* output */
-    double *pflowval;
-    double *pmincut;
-    
-    double *pri;
-    double *prj;
-    double *prv;
+    int iflow;
+    double flow;
+    int *pimincut = NULL;
+    double *pres = NULL;
     
     /* 
      * The current calling pattern is
-     * matching_mex(A,verify,initial_match_name,augmenting_path_name)
+     * max_flow_mex(A,u,v,algname)
+     * max_flow_mex(A,u,v,algname,scap,tcap)
+     * max_flow_mex(A,u,v,algname,scap,tcap,integer)
+     * where u and v are sets of source and sink vertices and 
+     * scap and tcap are capacities from the source to each vertex and
+     * from each vertex to the sink, or empty.  The matrix A is the 
+     * transpose of the flow network.  If integer is 0, then the 
+     * capacities are not rounded down to integers.
      */
     
     const mxArray* arg_matrix;
-    const mxArray* arg_source;
-    const mxArray* arg_sink;
     const mxArray* arg_algname;    
     int required_arguments = 4;
     
-    if (nrhs != required_arguments) {
+    if (nrhs != required_arguments && nrhs != required_arguments+2 &&
+        nrhs != required_arguments+3) {
         mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
-            "the function requires %i arguments, not %i\n", 
-            required_arguments, nrhs);
+            "the function requires %i, %i, or %i arguments, not %i\n", 
+            required_arguments, required_arguments+2, required_arguments+3,
+            nrhs);
     }
     
     arg_matrix = prhs[0];
-    arg_source = prhs[1];
-    arg_sink = prhs[2];
     arg_algname = prhs[3];
     
-    u = (mbglIndex)load_scalar_arg(arg_source,1);
-    v = (mbglIndex)load_scalar_arg(arg_sink,2);
     algname = load_string_arg(arg_algname,3);
     
     /* The first input must be a sparse matrix. */
-    mrows = mxGetM(prhs[0]);
-    ncols = mxGetN(prhs[0]);
+    mrows = mxGetM(arg_matrix);
+    ncols = mxGetN(arg_matrix);
     if (mrows != ncols ||
-        !mxIsSparse(prhs[0]) ||
-        !mxIsDouble(prhs[0]) || 
-        mxIsComplex(prhs[0])) 
+        !mxIsSparse(arg_matrix) ||
+        !mxIsDouble(arg_matrix) || 
+        mxIsComplex(arg_matrix)) 
     {
         mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
             "the matrix must be sparse, square, and double valued");
@@ -338,136 +215,97 @@ void mexFunction(int nlhs, mxArray *plhs[],
     
     n = mrows;
     
-    /* Get the sparse matrix */
-    A_val = mxGetPr(prhs[0]);
-    A_row = mxGetIr(prhs[0]);
-    A_col = mxGetJc(prhs[0]);
-    
-    nz = A_col[n];
+    /* recall that we've transposed the matrix */
+    a = mxGetPr(arg_matrix);
+    ja = mxGetIr(arg_matrix);
+    ia = mxGetJc(arg_matrix);
     
-    /* Quick input check */
-    if (u > n || u < 1) {
-        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
-            "invalid source vertex: %i\n", u);
-    } 
+    nz = ia[n];
     
-    if (v > n || v < 1) {
-        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
-            "invalid sink vertex: %i\n", v);
+    sources = load_terminals(prhs[1], n, 2, &nsources);
+    sinks = load_terminals(prhs[2], n, 3, &nsinks);
+    if (nrhs > required_arguments) {
+        scap = load_terminal_capacities(prhs[4], n, 5);
+        tcap = load_terminal_capacities(prhs[5], n, 6);
+    }
+    if (nrhs > required_arguments+2) {
+        integer = (int)load_scalar_arg(prhs[6],7);
     }
     
-    u = u-1;
-    v = v-1;
-    
-    /* build flow connectivity structure */
-    build_matrix(n,A_row,A_col,A_val, 
-        &pi_flow, &j_flow, &cap, &rev_edge_map);
-    
-    /* allocate the residual map */
-    res = mxCalloc(sizeof(int),pi_flow[n]);
-    
-    /*i = 0;
-    for (k=0; k < pi_flow[n]; k++)
-    {
-        // get the correct row
-        while (k >= pi_flow[i+1]) { ++i; }
-        mexPrintf("(%i,%i) (%i,%i)\n", i,j_flow[k],cap[k],res[k]);
-    }*/
-    
-    /* mexPrintf("Calling flow (%i,%i)...\n", u, v); */
-    #ifdef _DEBUG
-    mexPrintf("max_flow(%s)...", algname);
-    #endif 
     if (strcmp(algname,"push_relabel") == 0) {
-        push_relabel_max_flow(n,j_flow,pi_flow,
-            u,v,cap,res,rev_edge_map,&flow);
+        algorithm = 1;
     } else if (strcmp(algname, "edmunds_karp") == 0) {
-        edmunds_karp_max_flow(n,j_flow,pi_flow,
-            u,v,cap,res,rev_edge_map,&flow);
+        algorithm = 2;
     } else if (strcmp(algname, "kolmogorov") == 0) {
-        kolmogorov_max_flow(n,j_flow,pi_flow,
-            u,v,cap,res,rev_edge_map,&flow);
+        algorithm = 3;
+    } else if (strcmp(algname, "parallel_push_relabel") == 0) {
+        algorithm = 4;
+    } else if (strcmp(algname, "dinic") == 0) {
+        algorithm = 5;
+    } else if (strcmp(algname, "pseudoflow") == 0) {
+        algorithm = 6;
     } else {
         mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
             "algname option %s is invalid\n", 
             algname);
     }
+    if (!integer && algorithm == 2) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "algname option %s does not support double capacities\n", 
+            algname);
+    }
+    
+    if (nlhs >= 2) {
+        plhs[1] = mxCreateDoubleMatrix(n,1,mxREAL);
+        pimincut = (int*)mxGetPr(plhs[1]);
+    }
+    if (nlhs >= 3) {
+        plhs[2] = mxCreateDoubleMatrix(nz,1,mxREAL);
+        pres = mxGetPr(plhs[2]);
+    }
     
     #ifdef _DEBUG
-    mexPrintf("done!\n");
+    mexPrintf("max_flow(%s)...", algname);
     #endif 
     
-    /*i = 0;
-    for (k=0; k < pi_flow[n]; k++)
-    {
-        // get the correct row
-        while (k >= pi_flow[i+1]) { ++i; }
-        mexPrintf("(%i,%i) (%i,%i)\n", i,j_flow[k],cap[k],res[k]);
-    }*/
+    create_flow_network(n, ja, ia, &net);
+    if (integer) {
+        rval = flow_network_max_flow(net, a, nsources, sources, scap, 
+            nsinks, sinks, tcap, algorithm, &iflow, pimincut, pres);
+        flow = (double)iflow;
+    } else {
+        rval = flow_network_max_flow_double(net, a, nsources, sources, scap, 
+            nsinks, sinks, tcap, algorithm, &flow, pimincut, pres);
+    }
+    free_flow_network(net);
     
-    if (nlhs >= 1)
-    {
-        plhs[0] = mxCreateDoubleMatrix(1,1, mxREAL);
-        pflowval = mxGetPr(plhs[0]);
-        pflowval[0] = (double)flow;
+    #ifdef _DEBUG
+    mexPrintf("done!\n");
+    #endif 
+    
+    if (rval == -1) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidParameter",
+            "a vertex cannot be both a source and a sink");
+    } else if (rval == -2) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidParameter",
+            "the capacities are too large for an integer flow");
     }
     
+    plhs[0] = mxCreateDoubleMatrix(1,1, mxREAL);
+    *mxGetPr(plhs[0]) = flow;
+    
     if (nlhs >= 2)
     {
-        int *pimincut;
-        
-        plhs[1] = mxCreateDoubleMatrix(n,1,mxREAL);
-        pmincut = mxGetPr(plhs[1]);
-        
-        pimincut = (int*)pmincut;
-        
-        build_cut(u, n, pi_flow, j_flow, cap, res, pimincut);
-        
-        test_cut(flow,pimincut,n,A_row,A_col,A_val);
+        test_cut(flow,integer,pimincut,n,ja,ia,a,scap,tcap);
         
         /* now expand mincut to the full dataset, we need to
          * do this operation backwards because pimincut has integer
          * entries specified and we are expanding them to double.
          */
-        expand_int_to_double(pimincut,pmincut,n,0.0);
-    }
-    
-    if (nlhs >= 3)
-    {
-        plhs[2] = mxCreateDoubleMatrix(nz,1,mxREAL);
-        plhs[3] = mxCreateDoubleMatrix(nz,1,mxREAL);
-        plhs[4] = mxCreateDoubleMatrix(nz,1,mxREAL);
-        
-        pri = mxGetPr(plhs[2]);
-        prj = mxGetPr(plhs[3]);
-        prv = mxGetPr(plhs[4]);
-        
-        /* j will be our index into the new matrix. */
-        j = 0;
-        
-        for (i=0;i<n;i++)
-        {
-            for (k=pi_flow[i];k<pi_flow[i+1];k++)
-            {
-                if (cap[k] != 0)
-                {
-                    /* since cap[k] != 0, this is a real edge */
-                    pri[j] = i+1;
-                    prj[j] = j_flow[k]+1;
-                    prv[j] = res[k];
-                    j++;
-                }
-            }
-        }
-        
-        if (j != nz)
-        {
-            mexPrintf("error... j != nz...\n");
-        }
+        expand_int_to_double(pimincut,mxGetPr(plhs[1]),n,0.0);
     }
     
     #ifdef _DEBUG
     mexPrintf("return\n");
     #endif 
 }
-
@@ -15,6 +15,8 @@
  * 2007-04-15: Fixed error with mallocing the maximum amount of memory by
  *   checking for an empty or singleton graph and simply returning that.
  * 2007-12-14: Added option for rooted call with prim's algorithm
+ * 2026-10-19: Added boruvka algorithm
+ *   Added filter_kruskal algorithm with an edge index output
  */
 
 #include "mex.h"
@@ -50,7 +52,7 @@ void mexFunction(int nlhs, mxArray *plhs[],
     int reweighted = 0;
 
     /* output data */
-    double *it, *jt, *vt;
+    double *it, *jt, *vt, *et = NULL;
 
     /* mst type string */
     char *algname;
@@ -162,6 +164,7 @@ void mexFunction(int nlhs, mxArray *plhs[],
         plhs[0] = mxCreateDoubleMatrix(n-1,1,mxREAL);
         plhs[1] = mxCreateDoubleMatrix(n-1,1,mxREAL);
         plhs[2] = mxCreateDoubleMatrix(n-1,1,mxREAL);
+        if (nlhs > 3) { plhs[3] = mxCreateDoubleMatrix(n-1,1,mxREAL); }
     }
     else
     {
@@ -173,12 +176,20 @@ void mexFunction(int nlhs, mxArray *plhs[],
         plhs[0] = mxCreateDoubleMatrix(n-1,1,mxREAL);
         plhs[1] = mxCreateDoubleMatrix(n-1,1,mxREAL);
         plhs[2] = mxCreateDoubleMatrix(n-1,1,mxREAL);
+        if (nlhs > 3) { plhs[3] = mxCreateDoubleMatrix(n-1,1,mxREAL); }
         return;
     }
     /* create the output vectors */
     it = mxGetPr(plhs[0]);
     jt = mxGetPr(plhs[1]);
     vt = mxGetPr(plhs[2]);
+    if (nlhs > 3) { et = mxGetPr(plhs[3]); }
+
+    if (nlhs > 3 && strcmp(algname, "filter_kruskal") != 0)
+    {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidParameter",
+            "the edge index output is only computed by filter_kruskal");
+    }
 
     #ifdef _DEBUG
     mexPrintf("mst_alg_%s...",algname);
@@ -200,6 +211,23 @@ void mexFunction(int nlhs, mxArray *plhs[],
         kruskal_mst(n, ja, ia, a,
             (mwIndex*)it,(mwIndex*)jt, vt, &nedges);
     }
+    else if (strcmp(algname, "boruvka") == 0)
+    {
+        if (boruvka_mst(n, ja, ia, a,
+                (mwIndex*)it,(mwIndex*)jt, vt, &nedges) != 0)
+        {
+            mexErrMsgIdAndTxt("matlab_bgl:invalidParameter",
+                "the edge weights are not symmetric");
+        }
+    }
+    else if (strcmp(algname, "filter_kruskal") == 0)
+    {
+        /* the edge indices still need a place to go */
+        if (et == NULL) { et = mxCalloc(n-1, sizeof(mwIndex)); }
+        filter_kruskal_mst(n, ja, ia, a,
+            (mwIndex*)it,(mwIndex*)jt, vt, (mwIndex*)et, &nedges);
+        if (nlhs <= 3) { mxFree(et); et = NULL; }
+    }
     else
     {
         mexErrMsgTxt("Unknown algname.");
@@ -210,11 +238,13 @@ void mexFunction(int nlhs, mxArray *plhs[],
 
     expand_index_to_double((mwIndex*)it, it, n-1, 1.0);
     expand_index_to_double((mwIndex*)jt, jt, n-1, 1.0);
+    if (et != NULL) { expand_index_to_double((mwIndex*)et, et, n-1, 1.0); }
 
     /* resize the output to the correct number of edges */
     mxSetM(plhs[0], nedges);
     mxSetM(plhs[1], nedges);
     mxSetM(plhs[2], nedges);
+    if (nlhs > 3) { mxSetM(plhs[3], nedges); }
 
     #ifdef _DEBUG
     mexPrintf("return\n");
@@ -0,0 +1,155 @@
+/** @file multiway_cut_mex.c
+ * @copyright Stanford University, 2006-2008
+ * @author David F. Gleich
+ * The mex interface to the libmbgl multiway cut function.
+ */
+
+/** History
+ *  2026-10-19: Initial version
+ */
+
+#include "mex.h"
+
+#if MX_API_VER < 0x07030000
+typedef int mwIndex;
+typedef int mwSize;
+#endif /* MX_API_VER */
+
+#include "matlab_bgl.h"
+#include "expand_macros.h"
+#include "common_functions.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * The mex function computes an approximate multiway cut.
+ */
+void mexFunction(int nlhs, mxArray *plhs[],
+                 int nrhs, const mxArray *prhs[])
+{
+    mwIndex mrows, ncols;
+
+    mwIndex n, nz, nterms, i;
+
+    /* sparse matrix */
+    mwIndex *ia, *ja;
+    double *a;
+
+    /* terminals */
+    double *pterms;
+    mwIndex *terms;
+
+    /* algorithm name */
+    char *algname;
+    int algorithm;
+    int rval;
+
+    /* result */
+    double *labels, *cut, *isolating, value;
+
+    /*
+     * The current calling pattern is
+     * multiway_cut_mex(A,terms,algname)
+     * where A is a symmetric matrix of edge weights, terms is the list
+     * of terminals, and algname is the max flow algorithm.
+     */
+
+    const mxArray* arg_matrix;
+    int required_arguments = 3;
+
+    if (nrhs != required_arguments) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "the function requires %i arguments, not %i\n",
+            required_arguments, nrhs);
+    }
+
+    arg_matrix = prhs[0];
+    algname = load_string_arg(prhs[2],2);
+
+    /* The first input must be a sparse matrix. */
+    mrows = mxGetM(arg_matrix);
+    ncols = mxGetN(arg_matrix);
+    if (mrows != ncols ||
+        !mxIsSparse(arg_matrix) ||
+        !mxIsDouble(arg_matrix) ||
+        mxIsComplex(arg_matrix))
+    {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "the matrix must be sparse, square, and double valued");
+    }
+
+    n = mrows;
+
+    /* the matrix is symmetric, so the transpose is the same */
+    a = mxGetPr(arg_matrix);
+    ja = mxGetIr(arg_matrix);
+    ia = mxGetJc(arg_matrix);
+    nz = ia[n];
+
+    if (strcmp(algname,"push_relabel") == 0) {
+        algorithm = 1;
+    } else if (strcmp(algname, "kolmogorov") == 0) {
+        algorithm = 3;
+    } else if (strcmp(algname, "parallel_push_relabel") == 0) {
+        algorithm = 4;
+    } else if (strcmp(algname, "dinic") == 0) {
+        algorithm = 5;
+    } else if (strcmp(algname, "pseudoflow") == 0) {
+        algorithm = 6;
+    } else {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "algname option %s is invalid\n", 
+            algname);
+    }
+
+    /* convert the terminals to zero-based indices */
+    nterms = mxGetNumberOfElements(prhs[1]);
+    pterms = mxGetPr(prhs[1]);
+    terms = mxCalloc(nterms > 0 ? nterms : 1, sizeof(mwIndex));
+    for (i = 0; i < nterms; i++) {
+        if (pterms[i] < 1 || pterms[i] > n) {
+            mexErrMsgIdAndTxt("matlab_bgl:invalidParameter",
+                "terminal %i is out of range", (int)i+1);
+        }
+        terms[i] = (mwIndex)pterms[i] - 1;
+    }
+
+    plhs[0] = mxCreateDoubleMatrix(n,1,mxREAL);
+    plhs[1] = mxCreateDoubleMatrix(nz,1,mxREAL);
+    plhs[3] = mxCreateDoubleMatrix(nterms,1,mxREAL);
+    labels = mxGetPr(plhs[0]);
+    cut = mxGetPr(plhs[1]);
+    isolating = mxGetPr(plhs[3]);
+
+    #ifdef _DEBUG
+    mexPrintf("multiway_cut...");
+    #endif
+
+    rval = multiway_cut(n, ja, ia, a, nterms, terms, algorithm,
+        (mwIndex*)labels, (int*)cut, isolating, &value);
+    
+    #ifdef _DEBUG
+    mexPrintf("done!\n");
+    #endif
+
+    mxFree(terms);
+
+    if (rval == -1) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidParameter",
+            "the terminals must be distinct and there must be at least two");
+    } else if (rval != 0) {
+        mexErrMsgIdAndTxt("matlab_bgl:callFailed",
+            "the libmbgl call failed with rval=%i", rval);
+    }
+
+    plhs[2] = mxCreateDoubleScalar(value);
+
+    expand_index_to_double((mwIndex*)labels, labels, n, 1.0);
+    expand_int_to_double((int*)cut, cut, nz, 0.0);
+
+    #ifdef _DEBUG
+    mexPrintf("return\n");
+    #endif
+}
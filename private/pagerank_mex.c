@@ -0,0 +1,163 @@
+/** @file pagerank_mex.c
+ * @copyright Stanford University, 2006-2008
+ * @author David F. Gleich
+ * The mex interface to the libmbgl pagerank function.
+ */
+
+/** History
+ *  2026-10-19: Initial version
+ */
+
+#include "mex.h"
+
+#if MX_API_VER < 0x07030000
+typedef int mwIndex;
+typedef int mwSize;
+#endif /* MX_API_VER */
+
+#include "matlab_bgl.h"
+
+#include "common_functions.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+/*
+ * The mex function computes a PageRank vector.
+ */
+void mexFunction(int nlhs, mxArray *plhs[],
+                 int nrhs, const mxArray *prhs[])
+{
+    int rval;
+    mwIndex mrows, ncols;
+
+    mwIndex n,nz;
+
+    /* sparse matrix */
+    mwIndex *ia, *ja;
+    double *a;
+
+    /* parameters */
+    double alpha, tol;
+    double *v;
+    mwIndex maxiter;
+
+    /* output data */
+    double *x;
+    mwIndex niter;
+    double residual;
+
+    /* used to switch between algorithm types */
+    int weight_type; /* = 0 if unweighted,
+                        = 1 if a vector of weights,
+                        = 2 if given by the matrix */
+
+    /*
+     * The current calling pattern is
+     * pagerank_mex(A,weight,alpha,v,tol,maxiter)
+     * where weight = 0 to use the unweighted version
+     *       weight = 'matrix' to use the values in the matrix
+     *       weight = vector to use a vector of weights
+     *       v = [] for a uniform teleportation vector
+     */
+
+    const mxArray* arg_matrix;
+    const mxArray* arg_weight;
+    int required_arguments = 6;
+
+    if (nrhs != required_arguments) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "the function requires %i arguments, not %i\n",
+            required_arguments, nrhs);
+    }
+
+    arg_matrix = prhs[0];
+    arg_weight = prhs[1];
+
+    alpha = load_scalar_arg(prhs[2],2);
+    tol = load_scalar_arg(prhs[4],4);
+    maxiter = (mwIndex)load_scalar_arg(prhs[5],5);
+
+    if (mxGetNumberOfElements(arg_weight) == 1)
+    {
+        /* make sure it is valid */
+        if ((int)mxGetScalar(arg_weight) != 0) {
+            mexErrMsgIdAndTxt("matlab_bgl:invalidParameter",
+                "unknown weight option %g\n", mxGetScalar(arg_weight));
+        }
+
+        weight_type = 0;
+        a = NULL;
+    }
+    else if (mxIsChar(arg_weight)) {
+        weight_type = 2;
+        a = mxGetPr(arg_matrix);
+    }
+    else if (mxIsDouble(arg_weight)) {
+        weight_type = 1;
+        a = mxGetPr(arg_weight);
+    }
+    else {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidParameter",
+            "unrecognized weight option");
+        return;
+    }
+
+    /* The first input must be a sparse matrix. */
+    mrows = mxGetM(arg_matrix);
+    ncols = mxGetN(arg_matrix);
+    if (mrows != ncols || !mxIsSparse(arg_matrix) ||
+        ((!mxIsDouble(arg_matrix) || mxIsComplex(arg_matrix)) && (weight_type == 2))
+        )
+    {
+        mexErrMsgTxt("Input must be a square sparse matrix.");
+    }
+
+    n = mrows;
+
+    /* recall that we've transposed the matrix */
+    ja = mxGetIr(arg_matrix);
+    ia = mxGetJc(arg_matrix);
+
+    nz = ia[n];
+
+    /* check the reweighting array to make sure it is acceptable */
+    if (weight_type == 1 && mxGetNumberOfElements(arg_weight) < nz) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidParameter",
+            "the weight array must have length >= nnz(A)");
+    }
+
+    v = NULL;
+    if (mxGetNumberOfElements(prhs[3]) > 0) {
+        if (!mxIsDouble(prhs[3]) || mxGetNumberOfElements(prhs[3]) != n) {
+            mexErrMsgIdAndTxt("matlab_bgl:invalidParameter",
+                "the teleportation vector must have length %i", n);
+        }
+        v = mxGetPr(prhs[3]);
+    }
+
+    plhs[0] = mxCreateDoubleMatrix(n,1,mxREAL);
+    x = mxGetPr(plhs[0]);
+
+    #ifdef _DEBUG
+    mexPrintf("pagerank...");
+    #endif
+
+    rval = pagerank(n, ja, ia, a, alpha, v, tol, maxiter, x,
+        &niter, &residual);
+    if (rval == -1) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidParameter",
+            "invalid alpha, teleportation vector, or edge weights");
+    }
+
+    #ifdef _DEBUG
+    mexPrintf("done!\n");
+    #endif
+
+    if (nlhs > 1) { plhs[1] = mxCreateDoubleScalar((double)niter); }
+    if (nlhs > 2) { plhs[2] = mxCreateDoubleScalar(residual); }
+
+    #ifdef _DEBUG
+    mexPrintf("return\n");
+    #endif
+}
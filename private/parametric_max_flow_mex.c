@@ -0,0 +1,143 @@
+/** @file parametric_max_flow_mex.c
+ * @copyright Stanford University, 2006-2008
+ * @author David F. Gleich
+ * The mex interface to the libmbgl parametric max flow functions.
+ */
+
+/** History
+ *  2026-10-19: Initial version
+ */
+
+#include "mex.h"
+
+#if MX_API_VER < 0x07030000
+typedef int mwIndex;
+typedef int mwSize;
+#endif /* MX_API_VER */
+
+#include "matlab_bgl.h"
+#include "expand_macros.h"
+#include "common_functions.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+/*
+ * The mex function runs a sequence of parametric max-flow problems.
+ */
+void mexFunction(int nlhs, mxArray *plhs[],
+                 int nrhs, const mxArray *prhs[])
+{
+    mwIndex mrows, ncols;
+
+    mwIndex n, k, nparams;
+
+    /* sparse matrix */
+    mwIndex *ia, *ja;
+    double *a;
+
+    /* terminal capacities */
+    double *scap, *tcap;
+
+    /* the parametric computation */
+    flow_network *net;
+    parametric_max_flow *pf;
+    int rval = 0;
+
+    /* result */
+    double *flows;
+    int *pimincut = NULL;
+
+    /*
+     * The current calling pattern is
+     * parametric_max_flow_mex(A,scap,tcap)
+     * where scap and tcap are n-by-k matrices of capacities from the 
+     * source to each vertex and from each vertex to the sink for each 
+     * of the k problems.  The matrix A is the transpose of the flow 
+     * network.
+     */
+
+    const mxArray* arg_matrix;
+    int required_arguments = 3;
+
+    if (nrhs != required_arguments) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "the function requires %i arguments, not %i\n",
+            required_arguments, nrhs);
+    }
+
+    arg_matrix = prhs[0];
+
+    /* The first input must be a sparse matrix. */
+    mrows = mxGetM(arg_matrix);
+    ncols = mxGetN(arg_matrix);
+    if (mrows != ncols ||
+        !mxIsSparse(arg_matrix) ||
+        !mxIsDouble(arg_matrix) ||
+        mxIsComplex(arg_matrix) ||
+        mrows == 0)
+    {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "the matrix must be sparse, square, non-empty, and double valued");
+    }
+
+    n = mrows;
+
+    /* recall that we've transposed the matrix */
+    a = mxGetPr(arg_matrix);
+    ja = mxGetIr(arg_matrix);
+    ia = mxGetJc(arg_matrix);
+
+    nparams = mxGetN(prhs[1]);
+    if (!mxIsDouble(prhs[1]) || mxIsSparse(prhs[1]) || 
+        mxGetM(prhs[1]) != n ||
+        !mxIsDouble(prhs[2]) || mxIsSparse(prhs[2]) || 
+        mxGetM(prhs[2]) != n || mxGetN(prhs[2]) != nparams) 
+    {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "the terminal capacities must be full n-by-k double matrices");
+    }
+    scap = mxGetPr(prhs[1]);
+    tcap = mxGetPr(prhs[2]);
+
+    plhs[0] = mxCreateDoubleMatrix(nparams,1,mxREAL);
+    flows = mxGetPr(plhs[0]);
+    if (nlhs >= 2) {
+        plhs[1] = mxCreateDoubleMatrix(n,nparams,mxREAL);
+    }
+
+    #ifdef _DEBUG
+    mexPrintf("parametric_max_flow...");
+    #endif
+
+    create_flow_network(n, ja, ia, &net);
+    create_parametric_max_flow(net, a, &pf);
+    for (k = 0; k < nparams && rval == 0; k++) {
+        if (nlhs >= 2) {
+            /* store the int cut in the double column for this problem */
+            pimincut = (int*)(mxGetPr(plhs[1]) + k*n);
+        }
+        rval = parametric_max_flow_update(pf, scap + k*n, tcap + k*n, 
+            &flows[k], pimincut);
+        if (nlhs >= 2 && rval == 0) {
+            expand_int_to_double(pimincut, mxGetPr(plhs[1]) + k*n, n, 0.0);
+        }
+    }
+    free_parametric_max_flow(pf);
+    free_flow_network(net);
+
+    #ifdef _DEBUG
+    mexPrintf("done!\n");
+    #endif
+
+    if (rval == -1) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidParameter",
+            "the terminal capacities must be non-negative, the source "
+            "capacities cannot decrease, and the sink capacities cannot "
+            "increase");
+    }
+
+    #ifdef _DEBUG
+    mexPrintf("return\n");
+    #endif
+}
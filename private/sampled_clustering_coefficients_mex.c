@@ -0,0 +1,114 @@
+/** @file sampled_clustering_coefficients_mex.c
+ * @copyright Stanford University, 2006-2008
+ * @author David F. Gleich
+ * The mex interface to the sampled clustering coefficients wrapper.
+ */
+
+/** History
+ *  2026-10-19: Initial version
+ */
+
+#include "mex.h"
+
+#if MX_API_VER < 0x07030000
+typedef int mwIndex;
+typedef int mwSize;
+#endif /* MX_API_VER */
+
+#include "matlab_bgl.h"
+
+#include "common_functions.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+/*
+ * The mex function runs a sampled clustering coefficients problem.
+ */
+void mexFunction(int nlhs, mxArray *plhs[],
+                 int nrhs, const mxArray *prhs[])
+{
+    mwIndex mrows, ncols;
+
+    mwIndex n;
+
+    /* sparse matrix */
+    mwIndex *ia, *ja;
+
+    /* sampling parameters */
+    int global;
+    mbglIndex nsamples, nsamples_used;
+    double tol, conf;
+    unsigned int seed;
+
+    /* output data */
+    double *cc, *ci;
+
+    int rval;
+
+    /*
+     * The current calling pattern is
+     * sampled_clustering_coefficients_mex(A,global,nsamples,tol,conf,seed)
+     */
+
+    const mxArray* arg_matrix;
+    int required_arguments = 6;
+
+    if (nrhs != required_arguments) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "the function requires %i arguments, not %i\n",
+            required_arguments, nrhs);
+    }
+
+    arg_matrix = prhs[0];
+
+    global = (int)load_scalar_arg(prhs[1], 1);
+    nsamples = (mbglIndex)load_scalar_arg(prhs[2], 2);
+    tol = load_scalar_arg(prhs[3], 3);
+    conf = load_scalar_arg(prhs[4], 4);
+    seed = (unsigned int)load_scalar_arg(prhs[5], 5);
+
+    /* The first input must be a sparse matrix. */
+    mrows = mxGetM(arg_matrix);
+    ncols = mxGetN(arg_matrix);
+    if (mrows != ncols || !mxIsSparse(arg_matrix))
+    {
+        mexErrMsgTxt("Input must be a square sparse matrix.");
+    }
+
+    n = mrows;
+
+    /* recall that we've transposed the matrix */
+    ja = mxGetIr(arg_matrix);
+    ia = mxGetJc(arg_matrix);
+
+    plhs[0] = mxCreateDoubleMatrix(1,1,mxREAL);
+    plhs[1] = mxCreateDoubleMatrix(1,1,mxREAL);
+    plhs[2] = mxCreateDoubleMatrix(1,1,mxREAL);
+
+    cc = mxGetPr(plhs[0]);
+    ci = mxGetPr(plhs[1]);
+
+    #ifdef _DEBUG
+    mexPrintf("sampled_clustering_coefficients...");
+    #endif
+
+    rval = sampled_clustering_coefficients(n, ja, ia,
+        global, nsamples, tol, conf, seed, cc, ci, &nsamples_used);
+
+    #ifdef _DEBUG
+    mexPrintf("done, rval=%i\n", rval);
+    #endif
+
+    if (rval != 0) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidParameter",
+            "invalid sampling parameters (samples=%g, tol=%g, confidence=%g)",
+            (double)nsamples, tol, conf);
+    }
+
+    *mxGetPr(plhs[2]) = (double)nsamples_used;
+
+    #ifdef _DEBUG
+    mexPrintf("return\n");
+    #endif
+}
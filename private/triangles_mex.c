@@ -0,0 +1,114 @@
+/** @file triangles_mex.c
+ * @copyright Stanford University, 2006-2008
+ * @author David F. Gleich
+ * The mex interface to the libmbgl triangle_counts and truss_numbers
+ * functions.
+ */
+
+/** History
+ *  2026-10-19: Initial version
+ */
+
+#include "mex.h"
+
+#if MX_API_VER < 0x07030000
+typedef int mwIndex;
+typedef int mwSize;
+#endif /* MX_API_VER */
+
+#include "matlab_bgl.h"
+
+#include "expand_macros.h"
+#include "common_functions.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * The mex function counts triangles or computes truss numbers.
+ */
+void mexFunction(int nlhs, mxArray *plhs[],
+                 int nrhs, const mxArray *prhs[])
+{
+    mwIndex mrows, ncols;
+
+    mwIndex n,nz;
+
+    /* sparse matrix */
+    mwIndex *ia, *ja;
+
+    /* output data */
+    double *edge_values;
+    double *ntri;
+
+    char *algname;
+
+    /*
+     * The current calling pattern is
+     * triangles_mex(A,algname)
+     * where algname = 'counts' to get the edge support and triangle count
+     *       algname = 'truss' to get the truss numbers
+     */
+
+    const mxArray* arg_matrix;
+    const mxArray* arg_algname;
+    int required_arguments = 2;
+
+    if (nrhs != required_arguments) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "the function requires %i arguments, not %i\n",
+            required_arguments, nrhs);
+    }
+
+    arg_matrix = prhs[0];
+    arg_algname = prhs[1];
+
+    algname = load_string_arg(arg_algname,1);
+
+    /* The first input must be a sparse matrix. */
+    mrows = mxGetM(arg_matrix);
+    ncols = mxGetN(arg_matrix);
+    if (mrows != ncols || !mxIsSparse(arg_matrix))
+    {
+        mexErrMsgTxt("Input must be a square sparse matrix.");
+    }
+
+    n = mrows;
+
+    /* recall that we've transposed the matrix */
+    ja = mxGetIr(arg_matrix);
+    ia = mxGetJc(arg_matrix);
+
+    nz = ia[n];
+
+    plhs[0] = mxCreateDoubleMatrix(nz,1,mxREAL);
+    plhs[1] = mxCreateDoubleMatrix(1,1,mxREAL);
+
+    edge_values = mxGetPr(plhs[0]);
+    ntri = mxGetPr(plhs[1]);
+
+    #ifdef _DEBUG
+    mexPrintf("triangles(%s)...", algname);
+    #endif
+
+    if (strcmp(algname,"counts") == 0) {
+        triangle_counts(n, ja, ia, (mbglDegreeType*)edge_values, ntri);
+    } else if (strcmp(algname,"truss") == 0) {
+        truss_numbers(n, ja, ia, (mbglDegreeType*)edge_values);
+    } else {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "algname option %s is invalid\n",
+            algname);
+    }
+
+    #ifdef _DEBUG
+    mexPrintf("done!\n");
+    #endif
+
+    expand_degree_to_double((mbglDegreeType*)edge_values,edge_values,nz,0.0);
+
+    #ifdef _DEBUG
+    mexPrintf("return\n");
+    #endif
+}
@@ -0,0 +1,145 @@
+/** @file update_core_numbers_mex.c
+ * @copyright Stanford University, 2007-2008
+ * @author David F. Gleich
+ * Wrap a call to the libmbgl update_core_numbers function.
+ */
+
+/** History
+ *  2026-10-19: Initial version
+ */
+
+#include "mex.h"
+
+#if MX_API_VER < 0x07030000
+typedef int mwIndex;
+typedef int mwSize;
+#endif /* MX_API_VER */
+
+#include "matlab_bgl.h"
+
+#include "expand_macros.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+/** Load a list of zero-based vertex indices stored as doubles. */
+mwIndex* load_vertex_list(const mxArray* a, mwIndex n, mwSize len, int k)
+{
+    mwIndex *verts;
+    double *vals;
+    mwSize i;
+
+    if (!mxIsDouble(a) || mxGetNumberOfElements(a) != len) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "argument %i must be a double vector of length %i", k+1, len);
+    }
+    vals = mxGetPr(a);
+    verts = mxCalloc(len+1, sizeof(mwIndex));
+    for (i = 0; i < len; i++) {
+        if (vals[i] < 0 || vals[i] >= n) {
+            mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+                "vertex %g in argument %i is out of range", vals[i]+1, k+1);
+        }
+        verts[i] = (mwIndex)vals[i];
+    }
+    return verts;
+}
+
+/*
+ * The mex function updates core numbers after a batch of edge changes.
+ */
+void mexFunction(int nlhs, mxArray *plhs[],
+                 int nrhs, const mxArray *prhs[])
+{
+    mwIndex mrows, ncols;
+
+    mwIndex n;
+
+    /* sparse matrix */
+    mwIndex *ia, *ja;
+
+    /* edge changes */
+    mwSize ninsert, ndelete;
+    mwIndex *insert_i, *insert_j, *delete_i, *delete_j;
+
+    /* input and output data */
+    double *cn0;
+    double *cn;
+    double *nvisited;
+    mwIndex nv;
+    mwIndex i;
+
+    /*
+     * The current calling pattern is
+     * update_core_numbers_mex(A,cn,ii,ij,di,dj)
+     * where A is the graph after the changes, cn are the core numbers
+     * before the changes, (ii,ij) are the inserted edges and (di,dj)
+     * are the deleted edges with zero-based indices.
+     */
+
+    const mxArray* arg_matrix;
+    int required_arguments = 6;
+
+    if (nrhs != required_arguments) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "the function requires %i arguments, not %i\n",
+            required_arguments, nrhs);
+    }
+
+    arg_matrix = prhs[0];
+
+    /* The first input must be a sparse matrix. */
+    mrows = mxGetM(arg_matrix);
+    ncols = mxGetN(arg_matrix);
+    if (mrows != ncols || !mxIsSparse(arg_matrix))
+    {
+        mexErrMsgTxt("Input must be a square sparse matrix.");
+    }
+
+    n = mrows;
+
+    if (!mxIsDouble(prhs[1]) || mxGetNumberOfElements(prhs[1]) != n) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "the core number vector must have length %i", n);
+    }
+    cn0 = mxGetPr(prhs[1]);
+
+    ninsert = mxGetNumberOfElements(prhs[2]);
+    insert_i = load_vertex_list(prhs[2], n, ninsert, 2);
+    insert_j = load_vertex_list(prhs[3], n, ninsert, 3);
+    ndelete = mxGetNumberOfElements(prhs[4]);
+    delete_i = load_vertex_list(prhs[4], n, ndelete, 4);
+    delete_j = load_vertex_list(prhs[5], n, ndelete, 5);
+
+    /* recall that we've transposed the matrix */
+    ja = mxGetIr(arg_matrix);
+    ia = mxGetJc(arg_matrix);
+
+    plhs[0] = mxCreateDoubleMatrix(n,1,mxREAL);
+    plhs[1] = mxCreateDoubleMatrix(1,1,mxREAL);
+
+    cn = mxGetPr(plhs[0]);
+    nvisited = mxGetPr(plhs[1]);
+
+    for (i = 0; i < n; i++) {
+        ((mbglDegreeType*)cn)[i] = (mbglDegreeType)cn0[i];
+    }
+
+    #ifdef _DEBUG
+    mexPrintf("update_core_numbers...");
+    #endif
+
+    update_core_numbers(n, ja, ia, ninsert, insert_i, insert_j,
+        ndelete, delete_i, delete_j, (mbglDegreeType*)cn, &nv);
+
+    #ifdef _DEBUG
+    mexPrintf("done!\n");
+    #endif
+
+    expand_degree_to_double((mbglDegreeType*)cn,cn,n,0.0);
+    *nvisited = (double)nv;
+
+    #ifdef _DEBUG
+    mexPrintf("return\n");
+    #endif
+}
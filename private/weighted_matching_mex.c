@@ -0,0 +1,121 @@
+/** @file weighted_matching_mex.c
+ * @copyright Stanford University, 2006-2008
+ * @author David F. Gleich
+ * The mex interface to the libmbgl approximate_weighted_matching function.
+ */
+
+/** History
+ *  2026-10-19: Initial version
+ */
+
+#include "mex.h"
+
+#if MX_API_VER < 0x07030000
+typedef int mwIndex;
+typedef int mwSize;
+#endif /* MX_API_VER */
+
+#include "matlab_bgl.h"
+#include "expand_macros.h"
+#include "common_functions.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+/*
+ * The mex function runs a weighted matching problem.
+ */
+void mexFunction(int nlhs, mxArray *plhs[],
+                 int nrhs, const mxArray *prhs[])
+{
+    mwIndex mrows, ncols;
+
+    mwIndex n,nz;
+
+    /* sparse matrix */
+    mwIndex *ia, *ja;
+    double *a;
+
+    /*
+     * The current calling pattern is
+     * weighted_matching_mex(A,weight)
+     * where weight = 'matrix' to use the values in the matrix
+     *       weight = vector to use a vector of weights
+     */
+
+    const mxArray* arg_matrix;
+    const mxArray* arg_weight;
+    int required_arguments = 2;
+
+    if (nrhs != required_arguments) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidMexArgument",
+            "the function requires %i arguments, not %i\n",
+            required_arguments, nrhs);
+    }
+
+    arg_matrix = prhs[0];
+    arg_weight = prhs[1];
+
+    if (mxIsChar(arg_weight)) {
+        a = mxGetPr(arg_matrix);
+    }
+    else if (mxIsDouble(arg_weight)) {
+        a = mxGetPr(arg_weight);
+    }
+    else {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidParameter",
+            "unrecognized weight option");
+        return;
+    }
+
+    /* The first input must be a sparse matrix. */
+    mrows = mxGetM(arg_matrix);
+    ncols = mxGetN(arg_matrix);
+    if (mrows != ncols || !mxIsSparse(arg_matrix) ||
+        ((!mxIsDouble(arg_matrix) || mxIsComplex(arg_matrix)) 
+          && mxIsChar(arg_weight))
+        )
+    {
+        mexErrMsgTxt("Input must be a square sparse matrix.");
+    }
+
+    n = mrows;
+
+    /* recall that we've transposed the matrix */
+    ja = mxGetIr(arg_matrix);
+    ia = mxGetJc(arg_matrix);
+
+    nz = ia[n];
+
+    /* check the reweighting array to make sure it is acceptable */
+    if (!mxIsChar(arg_weight) && mxGetNumberOfElements(arg_weight) < nz) {
+        mexErrMsgIdAndTxt("matlab_bgl:invalidParameter",
+            "the weight array must have length >= nnz(A)");
+    }
+
+    plhs[0] = mxCreateDoubleMatrix(n,1,mxREAL);
+    plhs[1] = mxCreateDoubleMatrix(1,1,mxREAL);
+
+    {
+        mwIndex null_vertex;
+
+        #ifdef _DEBUG
+        mexPrintf("approximate_weighted_matching...");
+        #endif
+
+        approximate_weighted_matching(n, ja, ia, a,
+            (mwIndex*)mxGetPr(plhs[0]), mxGetPr(plhs[1]), &null_vertex);
+
+        #ifdef _DEBUG
+        mexPrintf("done!\n");
+        #endif
+
+        expand_index_to_double_zero_special(
+            (mwIndex*)mxGetPr(plhs[0]), mxGetPr(plhs[0]),
+            n, 1.0, null_vertex);
+    }
+
+    #ifdef _DEBUG
+    mexPrintf("return\n");
+    #endif
+}
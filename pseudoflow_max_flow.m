@@ -0,0 +1,33 @@
+function [varargout]=pseudoflow_max_flow(A,u,v,varargin)
+% PSEUDOFLOW_MAX_FLOW Hochbaum's pseudoflow max flow algorithm
+%
+% Hochbaum's highest label pseudoflow algorithm finds a minimum cut with
+% a pseudoflow that saturates the edges out of the source and into the 
+% sink, and then recovers a maximum flow from the pseudoflow.  It is 
+% often faster than push relabel on large vision and segmentation 
+% networks.
+%
+% See the max_flow function for calling information and return parameters.
+% This function just calls max_flow(...,struct('algname','pseudoflow'));
+%
+% Example:
+%   load('graphs/max_flow_example.mat');
+%   pseudoflow_max_flow(A,1,8)
+
+% David Gleich
+% Copyright, Stanford University, 2007-2008
+
+%% History
+%  2026-10-19: Initial version
+%%
+
+algname = 'pseudoflow';
+if ~isempty(varargin), 
+    options = merge_options(struct(),varargin{:}); 
+    options.algname= algname;
+else options = struct('algname',algname); 
+end
+
+varargout = cell(1,max(nargout,1));
+
+[varargout{:}] = max_flow(A,u,v,options);
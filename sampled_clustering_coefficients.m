@@ -0,0 +1,66 @@
+function [cc ci nsamples] = sampled_clustering_coefficients(A,varargin)
+% SAMPLED_CLUSTERING_COEFFICIENTS Estimate clustering coefficients by sampling
+%
+% cc = sampled_clustering_coefficients(A) estimates the average clustering
+% coefficient of an undirected graph, mean(clustering_coefficients(A)),
+% from a random sample of wedges.  A wedge is a path (u,v,w) of length two
+% and it is closed if the edge (u,w) is in the graph.  
+%
+% [cc ci nsamples] = sampled_clustering_coefficients(A) also returns a 
+% confidence interval ci = [lower upper] for the estimate and the number of 
+% samples used.  The interval comes from Hoeffding's inequality and holds
+% for any graph.
+%
+% The runtime is O(N + M + k d) where k is the number of samples and d is
+% the maximum vertex degree; it does not depend on the number of triangles.
+% With the default options, k is about 18,000.
+%
+% ... = sampled_clustering_coefficients(A,...) takes a set of
+% key-value pairs or an options structure.  See set_matlab_bgl_options
+% for the standard options. 
+%   options.type: the statistic to estimate, 'average' samples a vertex
+%       uniformly and then a wedge at that vertex; 'global' samples wedges
+%       uniformly (a vertex is picked proportional to its wedges) and 
+%       estimates the global clustering coefficient, 3*triangles/wedges
+%       [{'average'} | 'global']
+%   options.samples: the number of wedges to sample, 0 picks the number
+%       of samples from tol and confidence [{0} | positive integer]
+%   options.tol: the half-width of the confidence interval [{0.01}]
+%   options.confidence: the confidence level of the interval [{0.95}]
+%   options.seed: the random seed [{0} | non-negative integer]
+%
+% Example:
+%    load('graphs/clique-10.mat');
+%    sampled_clustering_coefficients(A)
+%
+% See also CLUSTERING_COEFFICIENTS
+
+% David Gleich
+% Copyright, Stanford University, 2006-2008
+
+%% History
+%  2026-10-19: Initial version
+%%
+
+[trans check full2sparse] = get_matlab_bgl_options(varargin{:});
+if full2sparse && ~issparse(A), A = sparse(A); end
+
+options = struct('type', 'average', 'samples', 0, 'tol', 0.01, ...
+    'confidence', 0.95, 'seed', 0);
+options = merge_options(options,varargin{:});
+
+if check, check_matlab_bgl(A,struct('sym',1)); end
+
+switch lower(options.type)
+    case 'average'
+        global_cc = 0;
+    case 'global'
+        global_cc = 1;
+    otherwise
+        error('matlab_bgl:invalidParameter', ...
+            'unknown type option %s', options.type);
+end
+
+[cc h nsamples] = sampled_clustering_coefficients_mex(A, global_cc, ...
+    options.samples, options.tol, options.confidence, options.seed);
+ci = [max(cc-h,0) min(cc+h,1)];
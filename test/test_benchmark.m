@@ -9,6 +9,9 @@ function out=test_benchmark
 % 9 July 2007
 % Initial version
 %
+% 19 October 2026
+% Added a head-to-head benchmark of the max flow algorithms
+%
 
 %% History
 
@@ -51,6 +54,7 @@ rand('state',0);
 r.dt_large = 0;
 r.dt_med = 0;
 r.dt_small = 0;
+r.dt_flow = 0;
 testi = 1;
 
 %% airfoil mesh
@@ -64,6 +68,7 @@ A = A + diag(sparse(d));
 
 r.name = 'airfoil'; fprintf('Graph: %s\n', r.name);
 r.dt_large = bench_large(A,nrep);
+r.dt_flow = bench_flow(A,nrep);
 r.dt_med = NaN;
 r.dt_small = NaN;
 
@@ -76,6 +81,7 @@ A = west0479;
 
 r.name = 'west'; fprintf('Graph: %s\n', r.name);
 r.dt_large = bench_large(A,nrep);
+r.dt_flow = bench_flow(A,nrep);
 r.dt_med = bench_medium(A,nrep);
 r.dt_small = bench_small(A,nrep);
 
@@ -87,6 +93,7 @@ load('../graphs/cs-stanford');
 
 r.name = 'cs-stan'; fprintf('Graph: %s\n', r.name);
 r.dt_large = bench_large(A,nrep);
+r.dt_flow = bench_flow(A,nrep);
 r.dt_med = NaN;
 r.dt_small = NaN;
 
@@ -98,6 +105,7 @@ load('../graphs/minnesota');
 
 r.name = 'minneso'; fprintf('Graph: %s\n', r.name);
 r.dt_large = bench_large(A,nrep);
+r.dt_flow = bench_flow(A,nrep);
 r.dt_med = NaN;
 r.dt_small = NaN;
 
@@ -109,6 +117,7 @@ load('../graphs/tapir');
 
 r.name = 'tapir'; fprintf('Graph: %s\n', r.name);
 r.dt_large = bench_large(A,nrep);
+r.dt_flow = bench_flow(A,nrep);
 r.dt_med = bench_medium(A,nrep);
 r.dt_small = NaN;
 
@@ -120,6 +129,7 @@ fprintf('%5s ', ''); cellfun(@(s) fprintf(' %7s   ', s), {results.name}); fprint
 fprintf('%5s ','large'); fprintf('%7.3f s  ', [results.dt_large]); fprintf('\n');
 fprintf('%5s ','med');   fprintf('%7.3f s  ', [results.dt_med]); fprintf('\n');
 fprintf('%5s ','small');   fprintf('%7.3f s  ', [results.dt_small]); fprintf('\n');
+fprintf('%5s ','flow');   fprintf('%7.3f s  ', [results.dt_flow]); fprintf('\n');
 
 if nargout > 1
     out = results;
@@ -172,6 +182,34 @@ end
         fprintf('  %30s: %7.3f s\n', 'mst', op_dt);
     end
 
+    function dt=bench_flow(A,nrep)
+        % every max flow algorithm solves the same problems
+        n = size(A,1);
+        C = ceil(100*sprand(A));
+        us = ceil(rand(nrep,1)*n); vs = ceil(rand(nrep,1)*n);
+        algs = {'push_relabel','edmunds_karp','kolmogorov',...
+            'parallel_push_relabel','dinic','pseudoflow'};
+        fs = zeros(nrep,length(algs));
+        
+        dt = 0;
+        for ai=1:length(algs)
+            tic;
+            for ri=1:nrep
+                if us(ri) == vs(ri), continue; end
+                fs(ri,ai) = max_flow(C,us(ri),vs(ri),...
+                    struct('algname',algs{ai}));
+            end
+            op_dt = toc;
+            dt = dt + op_dt;
+            
+            fprintf('  %30s: %7.3f s\n', ['max_flow ' algs{ai}], op_dt);
+        end
+        if any(any(fs ~= repmat(fs(:,1),1,length(algs))))
+            error('matlab_bgl:test_benchmark', ...
+                'the max flow algorithms computed different flows');
+        end
+    end
+
     function dt=bench_medium(A,nrep)
         dt = 0;
         tic;
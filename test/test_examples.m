@@ -84,6 +84,10 @@ d = dfs(A,1);
 load_mbgl_graph('clr-25-2');
 [d pred] = dijkstra_sp(A,1);
 
+% dinic_max_flow
+load('../graphs/max_flow_example.mat');
+f=dinic_max_flow(A,1,8);
+
 % edge_weight_index
 load('../graphs/bfs_example.mat');
 [eil Ei] = edge_weight_index(A,struct('undirected',1));
@@ -118,6 +122,17 @@ A = erdos_reyni(100,0.05);
 load('../graphs/clr-26-1.mat');
 D=floyd_warshall_all_sp(A);
 
+% global_min_cut
+load('../graphs/max_flow_example.mat');
+[value cut] = global_min_cut(A+A');
+[value cut] = global_min_cut(A+A',struct('algname','karger_stein'));
+
+% gomory_hu_tree
+load('../graphs/max_flow_example.mat');
+T = gomory_hu_tree(A+A');
+[d dt pred] = bfs(T,1); p = path_from_pred(pred,8);
+f = min(T(sub2ind(size(T),p(1:end-1),p(2:end)))); % min cut from 1 to 8
+
 % grid_graph
 [A xy] = grid_graph(5,10);
 gplot(A,xy);
@@ -142,6 +157,10 @@ T=kruskal_mst(A);
 load('../graphs/dominator_tree_example.mat');
 p = lengauer_tarjan_dominator_tree(A,1);
 
+% local_flow_improve
+A = grid_graph(20,20); 
+[S cond] = local_flow_improve(A,1:190);
+
 % matching
 load('../graphs/matching_example.mat');
 [m,v] = matching(A);
@@ -168,6 +187,10 @@ sum(mmax>0)/2;             % maximum matching cardinality, should be 8
 load('../graphs/clr-24-1.mat');
 T=mst(A);
 
+% multiway_cut
+load('../graphs/max_flow_example.mat');
+[C labels value] = multiway_cut(A+A',[1 4 8]);
+
 % num_edges
 load('../graphs/dfs_example.mat');
 n = num_edges(A);
@@ -186,6 +209,10 @@ load('../graphs/clr-24-1.mat');
 prim_mst(A);
 T = prim_mst(A,struct('root',5)); % root the tree at vertex e
 
+% pseudoflow_max_flow
+load('../graphs/max_flow_example.mat');
+f=pseudoflow_max_flow(A,1,8);
+
 % push_relabel_max_flow
 load('../graphs/max_flow_example.mat');
 f=push_relabel_max_flow(A,1,8);
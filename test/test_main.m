@@ -151,7 +151,213 @@ end
 
 
 
+%% global_min_cut
+load('../graphs/max_flow_example.mat');
+A = A + A'; n = size(A,1);
+% the minimum cut separates vertex 1 from some other vertex
+f = inf; for v=2:n, f = min(f, max_flow(A,1,v)); end
+for alg={'stoer_wagner','karger_stein'}
+    [value cut] = global_min_cut(A,struct('algname',alg{1}));
+    if abs(value - f) > 1e-12 || ...
+            abs(value - sum(sum(A(cut==1,cut==-1)))) > 1e-12 || ...
+            all(cut == 1) || all(cut == -1)
+        error(msgid, 'global_min_cut failed');
+    end
+end
+% two cliques joined by one edge
+A = sparse(ones(5)-eye(5));
+A = blkdiag(A,A); A(5,6) = 1; A(6,5) = 1;
+for alg={'stoer_wagner','karger_stein'}
+    [value cut] = global_min_cut(A,struct('algname',alg{1}));
+    if value ~= 1 || length(unique(cut(1:5))) ~= 1 || ...
+            length(unique(cut(6:10))) ~= 1 || cut(1) == cut(6)
+        error(msgid, 'global_min_cut failed clique test');
+    end
+end
+% a disconnected graph
+if global_min_cut(blkdiag(A,A)) ~= 0
+    error(msgid, 'global_min_cut failed disconnected test');
+end
+
+%% gomory_hu_tree
+load('../graphs/max_flow_example.mat');
+A = A + A'; n = size(A,1);
+for alg={'push_relabel','kolmogorov','dinic','pseudoflow'}
+    [ti tj tv] = gomory_hu_tree(A,struct('algname',alg{1}));
+    T = sparse(ti,tj,tv,n,n); T = T + T';
+    for u=1:n
+        [d dt pred] = bfs(T,u);
+        for w=u+1:n
+            p = path_from_pred(pred,w);
+            if abs(min(T(sub2ind([n n],p(1:end-1),p(2:end)))) - ...
+                    max_flow(A,u,w)) > 1e-12
+                error(msgid, 'gomory_hu_tree failed min cut test');
+            end
+        end
+    end
+end
+% connected random graphs
+rand('state',0);
+for k=1:10
+    A = ceil(10*sprand(12,12,0.3)); A = A + A' + cycle_graph(12);
+    n = size(A,1);
+    [ti tj tv] = gomory_hu_tree(A,struct('algname','kolmogorov'));
+    T = sparse(ti,tj,tv,n,n); T = T + T';
+    for u=1:n
+        [d dt pred] = bfs(T,u);
+        for w=u+1:n
+            p = path_from_pred(pred,w);
+            if min(T(sub2ind([n n],p(1:end-1),p(2:end)))) ~= max_flow(A,u,w)
+                error(msgid, 'gomory_hu_tree failed random min cut test');
+            end
+        end
+    end
+end
+
+%% local_flow_improve
+% two cliques joined by an edge with a set that has the wrong vertex 
+A = sparse(ones(5)-eye(5));
+A = blkdiag(A,A); A(5,6) = 1; A(6,5) = 1;
+[S cond] = local_flow_improve(A,[1 2 3 4 6]);
+if ~isequal(find(S),(1:5)') || abs(cond(end) - 1/21) > 1e-12 || ...
+        abs(cond(1) - 9/21) > 1e-12
+    error(msgid, 'local_flow_improve failed');
+end
+[S cond] = local_flow_improve(A,1:6,struct('method','mqi'));
+if ~isequal(find(S),(1:5)') || abs(cond(end) - 1/21) > 1e-12
+    error(msgid, 'local_flow_improve failed mqi test');
+end
+% the best set does not change
+[S cond] = local_flow_improve(A,1:5);
+if ~isequal(find(S),(1:5)') || length(cond) ~= 1
+    error(msgid, 'local_flow_improve failed optimal set test');
+end
+
 %% max_flow
+% F is a feasible flow of value f from s to t
+flow_ok = @(A,F,s,t,f) ~full(any(any(F < -1e-12 | F > A + 1e-12))) && ...
+    norm(full(sum(F,2) - sum(F,1)') - f*(((1:size(A,1))' == s) - ...
+        ((1:size(A,1))' == t)),inf) <= 1e-12*max(f,1);
+load('../graphs/max_flow_example.mat');
+[f cut R F] = max_flow(A,1,8);
+if f ~= 4 || cut(1) ~= 1 || cut(8) ~= -1 || ~flow_ok(A,F,1,8,f)
+    error(msgid, 'max_flow failed');
+end
+% terminal capacities and sets of terminals give the same flow
+n = size(A,1);
+sc = zeros(n,1); sc(1) = sum(A(1,:))+1;
+tc = zeros(n,1); tc(8) = sum(A(:,8))+1;
+if max_flow(A,[],[],struct('source_capacity',sc,'sink_capacity',tc)) ~= f
+    error(msgid, 'max_flow failed terminal capacity test');
+end
+for alg={'push_relabel','kolmogorov','parallel_push_relabel','dinic',...
+        'pseudoflow'}
+    [f2 cut2] = max_flow(A,[1 2],[7 8],struct('algname',alg{1}));
+    if any(cut2([1 2]) ~= 1) || any(cut2([7 8]) ~= -1) || ...
+            f2 ~= sum(sum(A(cut2==1,cut2==-1)))
+        error(msgid, 'max_flow failed terminal set test');
+    end
+end
+[f2 cut2 R2 F2] = max_flow(A,1,8,struct('algname','parallel_push_relabel'));
+if f2 ~= f || ~flow_ok(A,F2,1,8,f2) || cut2(1) ~= 1 || cut2(8) ~= -1
+    error(msgid, 'max_flow failed parallel_push_relabel test');
+end
+[f2 cut2 R2 F2] = pseudoflow_max_flow(A,1,8);
+if f2 ~= f || ~flow_ok(A,F2,1,8,f2) || cut2(1) ~= 1 || cut2(8) ~= -1
+    error(msgid, 'max_flow failed pseudoflow test');
+end
+% double capacities are not rounded
+for alg={'push_relabel','kolmogorov','parallel_push_relabel','dinic',...
+        'pseudoflow'}
+    [f2 cut2 R2 F2] = max_flow(A/3,1,8, ...
+        struct('algname',alg{1},'integer_capacity',0));
+    if abs(f2 - f/3) > 1e-12 || ~flow_ok(A/3,F2,1,8,f2)
+        error(msgid, 'max_flow failed double capacity test');
+    end
+end
+% kolmogorov agrees with push_relabel on random graphs
+A = sparse([2 3 4 5 3 4 5 4],[1 1 1 1 2 2 2 3],[2 1 3 3 2 4 3 3],5,5);
+A = A + A';
+if max_flow(A,4,1,struct('algname','kolmogorov')) ~= 9
+    error(msgid, 'max_flow failed kolmogorov test');
+end
+rand('state',0);
+for k=1:50
+    A = ceil(10*sprand(20,20,0.2));
+    if mod(k,2), A = A + A'; end
+    f = max_flow(A,1,2);
+    [f2 cut2 R2 F2] = max_flow(A,1,2,struct('algname','kolmogorov'));
+    if f2 ~= f || ~flow_ok(A,F2,1,2,f2) || ...
+            f2 ~= sum(sum(A(cut2==1,cut2==-1)))
+        error(msgid, 'max_flow failed kolmogorov random test');
+    end
+    f = max_flow(A/3,[1 3],[2 4],struct('integer_capacity',0));
+    f2 = max_flow(A/3,[1 3],[2 4], ...
+        struct('algname','kolmogorov','integer_capacity',0));
+    if abs(f2 - f) > 1e-12*max(f,1)
+        error(msgid, 'max_flow failed kolmogorov random double test');
+    end
+end
+
+%% multiway_cut
+load('../graphs/max_flow_example.mat');
+A = A + A'; n = size(A,1); vs = [1 4 8];
+for alg={'push_relabel','kolmogorov','parallel_push_relabel','dinic',...
+        'pseudoflow'}
+    [C labels value iso] = multiway_cut(A,vs,struct('algname',alg{1}));
+    if any(labels(vs) ~= (1:3)') || abs(full(sum(sum(C)))/2 - value) > 1e-12 
+        error(msgid, 'multiway_cut failed');
+    end
+    % the terminals are disconnected without the cut edges
+    ci = components(A - C);
+    if length(unique(ci(vs))) ~= 3 || value > sum(iso) - max(iso) + 1e-12
+        error(msgid, 'multiway_cut failed cut test');
+    end
+    for k=1:3
+        if abs(iso(k) - max_flow(A,vs(k),setdiff(vs,vs(k)))) > 1e-12
+            error(msgid, 'multiway_cut failed isolating cut test');
+        end
+    end
+end
+% kolmogorov agrees with push_relabel on random graphs
+rand('state',0);
+for k=1:10
+    A = ceil(10*sprand(20,20,0.2)); A = A + A'; vs = [1 5 9 13];
+    [C labels value iso] = multiway_cut(A,vs);
+    [C2 labels2 value2 iso2] = multiway_cut(A,vs, ...
+        struct('algname','kolmogorov'));
+    ci = components(A - C2);
+    if any(iso2 ~= iso) || length(unique(ci(vs))) ~= 4 || ...
+            value2 > sum(iso2) - max(iso2)
+        error(msgid, 'multiway_cut failed kolmogorov random test');
+    end
+end
+
+%% parametric_max_flow
+load('../graphs/max_flow_example.mat');
+n = size(A,1); lambda = 0:0.5:3;
+sc = zeros(n,1); sc([1 2]) = 1; sc = sc*lambda;
+tc = zeros(n,1); tc([7 8]) = 4; tc = tc*(4-lambda);
+[fs cuts] = parametric_max_flow(A,sc,tc);
+for k=1:length(lambda)
+    f2 = max_flow(A,[],[],struct('source_capacity',sc(:,k),...
+        'sink_capacity',tc(:,k),'integer_capacity',0));
+    if abs(fs(k) - f2) > 1e-12
+        error(msgid, 'parametric_max_flow failed flow test');
+    end
+    if k > 1 && any(cuts(cuts(:,k-1)==1,k) ~= 1)
+        error(msgid, 'parametric_max_flow failed nested cut test');
+    end
+end
+monotone = 1;
+try
+    parametric_max_flow(A,fliplr(sc),tc);
+catch
+    monotone = 0;
+end
+if monotone
+    error(msgid, 'parametric_max_flow failed decreasing source test'); 
+end
 
 %% pred_from_path
 
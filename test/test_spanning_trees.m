@@ -12,6 +12,45 @@ try
 catch
 end
 
+% make sure boruvka and kruskal find the same forest
+load('../graphs/clr-24-1.mat');
+A(2,3) = 9; A(3,2) = 9;
+Tk = mst(A,struct('algname','kruskal'));
+Tb = mst(A,struct('algname','boruvka'));
+if nnz(Tk - Tb) ~= 0
+    error(msgid, 'mst(boruvka) failed');
+end
+rand('state',0);
+A = blkdiag(A,sprand(50,50,0.1)); A = A + A'; A = A - diag(diag(A));
+[i j v] = mst(A,struct('algname','boruvka'));
+[ik jk vk] = mst(A,struct('algname','kruskal'));
+if length(v) ~= length(vk) || abs(sum(v) - sum(vk)) > 1e-12*sum(vk)
+    error(msgid, 'mst(boruvka) failed on a disconnected graph');
+end
+Tb = mst(A,struct('algname','boruvka'));
+Tf = mst(A,struct('algname','filter_kruskal'));
+if nnz(Tb - Tf) ~= 0
+    error(msgid, 'mst(filter_kruskal) failed');
+end
+[i j v ei] = mst(A,struct('algname','filter_kruskal'));
+Av = nonzeros(A);
+if any(Av(ei) ~= v)
+    error(msgid, 'mst(filter_kruskal) returned the wrong edge indices');
+end
+% asymmetric edge weights that hook a 4-cycle are an error in boruvka
+% even without the symmetry check
+W = sparse([1 2 3 4 2 3 4 1],[2 3 4 1 1 2 3 4],[1 1 1 1 5 5 5 5],4,4);
+failed = 0;
+try
+    mst(spones(W),struct('algname','boruvka','nocheck',1, ...
+        'edge_weight',edge_weight_vector(spones(W),W)));
+catch
+    failed = 1;
+end
+if ~failed
+    error(msgid, 'mst(boruvka) did not report asymmetric weights');
+end
+
 %% prim_mst
 load('../graphs/clr-24-1.mat');
 % change the graph to make the result unique
@@ -28,6 +28,20 @@ if any(any(spones(A) - spones(Ec)))
     error(msgid, 'different non-zero structure in edge centrality matrix');
 end
 
+% the approximation is exact when the sample has every vertex
+Ac = cycle_graph(n);
+bc = betweenness_centrality(Ac,struct('unweighted',1));
+bca = betweenness_centrality(Ac,struct('unweighted',1,'approx',1));
+if norm(bc-bca,inf) > 1e-8*norm(bc,inf)
+    error(msgid, 'approximate betweenness_centrality differs from exact');
+end
+% every source in a cycle contributes the same total centrality
+bca = betweenness_centrality(Ac,struct('unweighted',1,'approx',1,...
+    'epsilon',0,'samples',3,'seed',1));
+if abs(sum(bca)-sum(bc)) > 1e-8*sum(bc)
+    error(msgid, 'approximate betweenness_centrality has the wrong scale');
+end
+
 [bc,Ec] = betweenness_centrality(A,struct('istrans',1));
 if any(any(spones(A) - spones(Ec)))
     error(msgid, 'different non-zero structure in edge centrality matrix');
@@ -55,6 +69,28 @@ if any(ccfs ~= ccfs(1))
     error(msgid, 'clustering_coefficients failed');
 end
 
+%% sampled_clustering_coefficients
+
+% all wedges are closed in a clique and open in a cycle
+A = sparse(ones(5)-eye(5));
+[cc ci] = sampled_clustering_coefficients(A,struct('samples',100));
+if cc ~= 1 || ci(2) ~= 1
+    error(msgid, 'sampled_clustering_coefficients failed on a clique');
+end
+cc = sampled_clustering_coefficients(cycle_graph(10),struct('type','global'));
+if cc ~= 0
+    error(msgid, 'sampled_clustering_coefficients failed on a cycle');
+end
+
+% the estimate must be within the tolerance of the exact value
+load('../graphs/padgett-florentine.mat');
+A = spones(A);
+[cc ci] = sampled_clustering_coefficients(A,struct('tol',0.02,'confidence',0.999));
+ccfs = clustering_coefficients(A,struct('unweighted',1,'undirected',1));
+if mean(ccfs) < ci(1) || mean(ccfs) > ci(2)
+    error(msgid, 'sampled_clustering_coefficients failed accuracy test');
+end
+
 %% core_numbers
 load('../graphs/kt-7-2.mat');
 A = spones(A);
@@ -65,6 +101,10 @@ cn2 = core_numbers(A,struct('unweighted',0));
 if any(cn-cn2)
     error(msgid, 'core_numbers failed equivalence test');
 end
+[cn2 rt] = core_numbers(A);
+if any(cn-cn2)
+    error(msgid, 'core_numbers failed parallel equivalence test');
+end
 
 A = [0 -1 -2; -1 0 -2; -2 -2 0];
 cn = core_numbers(sparse(A),struct('unweighted',0));
@@ -72,6 +112,95 @@ if any(cn-[-1; -1; -4])
     error(msgid, 'core_numbers failed negative test');
 end
 
+%% update_core_numbers
+A = sparse(ones(5)-eye(5));
+A(5,6) = 1; A(6,5) = 1; A(6,7) = 1; A(7,6) = 1;
+cn0 = core_numbers(A);
+B = A; B(1,2) = 0; B(2,1) = 0;
+B(1,7) = 1; B(7,1) = 1;
+cn = update_core_numbers(B,cn0,[1 7],[1 2]);
+if any(cn ~= core_numbers(B))
+    error(msgid, 'update_core_numbers failed on a clique with a tail');
+end
+cn = update_core_numbers(A,cn,[1 2],[1 7]);
+if any(cn ~= cn0)
+    error(msgid, 'update_core_numbers failed to restore a clique with a tail');
+end
+
+%% closeness_centrality
+n = 10;
+A = cycle_graph(n);
+c = closeness_centrality(A,struct('unweighted',1));
+if any(abs(c - (n-1)/sum([1:n/2 1:n/2-1])) > 1e-12)
+    error(msgid, 'closeness_centrality failed on a cycle');
+end
+A = sparse(1:n-1, 2:n, 1, n, n); A = A+A';
+h = closeness_centrality(A,struct('type','harmonic'));
+[hk,v] = closeness_centrality(A,struct('type','harmonic','topk',2));
+[hs,p] = sort(h,'descend');
+if any(abs(hk-hs(1:2)) > 1e-12) || any(abs(h(v)-hk) > 1e-12)
+    error(msgid, 'closeness_centrality failed topk harmonic test');
+end
+
+%% pagerank
+load('../graphs/padgett-florentine.mat');
+A = spones(A);
+A(end,end+1) = 1; A(end+1,end+1) = 0; % add a dangling vertex
+n = size(A,1);
+P = diag(1./max(sum(A,2),1))*A; d = sum(A,2) == 0;
+[x,niter,resid] = pagerank(A,struct('tol',1e-12));
+y = (speye(n) - 0.85*(P' + ones(n,1)*d'/n))\(0.15*ones(n,1)/n);
+if norm(x-y,1) > 1e-10 || resid >= 1e-12 || niter < 1
+    error(msgid, 'pagerank failed on padgett-florentine');
+end
+v = zeros(n,1); v(1) = 2;
+x = pagerank(A,struct('v',v,'tol',1e-12));
+y = (speye(n) - 0.85*(P' + v*d'/2))\(0.15*v/2);
+if norm(x-y,1) > 1e-10
+    error(msgid, 'pagerank failed personalized test');
+end
+
+%% local_pagerank
+A = sparse(ones(5)-eye(5));
+A = blkdiag(A,A); A(5,6) = 1; A(6,5) = 1;
+[x,set,cond] = local_pagerank(A,1,struct('eps',1e-8));
+y = pagerank(A,struct('v',sparse(1,1,1,10,1),'alpha',0.99,'tol',1e-12));
+if norm(x-y,inf) > 1e-6
+    error(msgid, 'local_pagerank differs from pagerank');
+end
+if ~isequal(sort(set),(1:5)') || abs(cond - 1/21) > 1e-12
+    error(msgid, 'local_pagerank failed to find the sweep cut');
+end
+
+%% triangle_counts
+A = sparse(ones(5)-eye(5));
+[S t] = triangle_counts(A);
+if t ~= 10 || any(nonzeros(S) ~= 3)
+    error(msgid, 'triangle_counts failed on a clique');
+end
+[S t] = triangle_counts(cycle_graph(10));
+if t ~= 0 || nnz(S) ~= 0
+    error(msgid, 'triangle_counts failed on a cycle');
+end
+load('../graphs/padgett-florentine.mat');
+A = spones(A);
+[S t] = triangle_counts(A);
+if t ~= trace(A^3)/6 || any(any(S ~= (A*A).*A))
+    error(msgid, 'triangle_counts failed on padgett-florentine');
+end
+
+%% truss_numbers
+A = sparse(ones(5)-eye(5));
+A(5,6) = 1; A(6,5) = 1;
+T = truss_numbers(A);
+if any(nonzeros(T(1:5,1:5)) ~= 5) || T(5,6) ~= 2
+    error(msgid, 'truss_numbers failed on a clique with a tail');
+end
+t = truss_numbers(A,struct('edge_list',1));
+if any(t ~= nonzeros(T))
+    error(msgid, 'truss_numbers failed edge_list test');
+end
+
 %% dominator_tree
 load('../graphs/dominator_tree_example.mat');
 p = lengauer_tarjan_dominator_tree(A,1);
@@ -145,6 +274,22 @@ if any(p ~= pred)
    error(msgid, 'lengauer_tarjan_dominator_tree failed test');
 end
 
+%% dominator_tree
+p = dominator_tree(A,1);
+if any(p ~= pred)
+   error(msgid, 'dominator_tree failed test');
+end
+P = dominator_tree(A,[1 3 10]);
+if any(P(1,:) ~= pred) || P(2,3) ~= 0 || P(2,1) ~= 0 || P(2,4) ~= 3 ...
+        || P(3,10) ~= 0 || P(3,11) ~= 10 || P(3,13) ~= 12
+   error(msgid, 'dominator_tree failed batched test');
+end
+% vertex 4 is a predecessor of vertex 3 that is not reachable from 1
+A=sparse([1 2 4],[2 3 3],1,4,4);
+if any(dominator_tree(A,1) ~= [0 1 2 0])
+   error(msgid, 'dominator_tree failed unreachable predecessor test');
+end
+
 %% edmonds_maximum_cardinality_matching
 load('../graphs/matching_example.mat');
 [m,v] = edmonds_maximum_cardinality_matching(A);
@@ -161,8 +306,62 @@ catch
 end
 load('../graphs/matching_example.mat');
 [m,v] = matching(A);
+for init={'karp_sipser','parallel_greedy'}
+    [m,v] = matching(A,struct('initial_match',init{1}));
+    if ~v || nnz(m)/2 ~= 8
+        error(msgid, 'matching failed %s test', init{1});
+    end
+    m = matching(A,struct('initial_match',init{1},'augmenting_path','none'));
+    if any(m(m(m>0)) ~= find(m>0)) || nnz(triu(A(m==0,m==0),1))
+        error(msgid, 'matching failed %s maximal test', init{1});
+    end
+end
+rand('state',0);
+B = sprand(40,30,0.1);
+G = spaugment(B,0); G = spones(G - diag(diag(G)));
+[m,v] = matching(G,struct('augmenting_path','hopcroft_karp'));
+[m2,v2] = matching(G,struct('bipartition',[zeros(40,1); ones(30,1)],...
+    'augmenting_path','hopcroft_karp'));
+if ~v || ~v2 || nnz(m)/2 ~= sprank(B) || nnz(m2)/2 ~= sprank(B) ...
+        || any(m(m(m>0)) ~= find(m>0))
+    error(msgid, 'matching failed hopcroft_karp test');
+end
+bipartite = 1;
+try
+    matching(cycle_graph(5,struct('directed',0)), ...
+        struct('augmenting_path','hopcroft_karp'));
+catch
+    bipartite = 0;
+end
+if bipartite, error(msgid,'matching failed hopcroft_karp odd cycle test'); end
+% an edge inside one side of the bipartition is an error
+G(1,2) = 1; G(2,1) = 1;
+bipartite = 1;
+try
+    matching(G,struct('bipartition',[zeros(40,1); ones(30,1)],...
+        'augmenting_path','hopcroft_karp'));
+catch
+    bipartite = 0;
+end
+if bipartite, error(msgid,'matching failed hopcroft_karp side test'); end
 
 
+%% weighted_matching
+load('../graphs/matching_example.mat');
+[m,w] = weighted_matching(spones(A));
+if any(m(m(m>0)) ~= find(m>0)) || nnz(m)/2 ~= w || w < 4
+    error(msgid, 'weighted_matching failed');
+end
+% the greedy matching of the path 1-2-3-4 with weights 2,3,2 is (2,3)
+A = sparse([1 2 3],[2 3 4],[2 3 2],4,4); A = A+A';
+[m,w] = weighted_matching(A);
+if any(m ~= [0 3 2 0]') || w ~= 3
+    error(msgid, 'weighted_matching failed path test');
+end
+[m,w] = weighted_matching(A,struct('edge_weight',ones(nnz(A),1)));
+if w ~= 2 || any(m(m(m>0)) ~= find(m>0))
+    error(msgid, 'weighted_matching failed edge_weight test');
+end
 
 
 %% test_dag
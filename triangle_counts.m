@@ -0,0 +1,52 @@
+function [S t] = triangle_counts(A,varargin)
+% TRIANGLE_COUNTS Count the triangles in an undirected graph
+%
+% [S t] = triangle_counts(A) returns a sparse matrix S where S(i,j) is the
+% number of triangles that contain the edge (i,j), and the total number of
+% triangles t.  S(i,j) is called the support of the edge (i,j).  Edges in 
+% no triangle have support 0, so S only has the edges of A that are in a
+% triangle; use the edge_list option to get a value for every edge.  The
+% number of triangles at each vertex is full(sum(S,2))/2.
+%
+% [s t] = triangle_counts(A,struct('edge_list',1)) returns the support
+% as a vector in the same order as the edges in indexed_sparse and 
+% edge_weight_vector.
+%
+% The graph must be undirected.  Self-loops are ignored.  The runtime is
+% O(M^1.5).
+%
+% ... = triangle_counts(A,...) takes a set of
+% key-value pairs or an options structure.  See set_matlab_bgl_options
+% for the standard options. 
+%   options.edge_list: return the support as a vector over the edges 
+%       instead of a matrix [{0} | 1]
+%
+% Example:
+%    load('graphs/clique-10.mat');
+%    [S t] = triangle_counts(A)
+%
+% See also TRUSS_NUMBERS, CLUSTERING_COEFFICIENTS
+
+% David Gleich
+% Copyright, Stanford University, 2006-2008
+
+%% History
+%  2026-10-19: Initial version
+%%
+
+[trans check full2sparse] = get_matlab_bgl_options(varargin{:});
+if full2sparse && ~issparse(A), A = sparse(A); end
+
+options = struct('edge_list', 0);
+options = merge_options(options,varargin{:});
+
+if check, check_matlab_bgl(A,struct('sym',1)); end
+
+[s t] = triangles_mex(A,'counts');
+
+if options.edge_list
+    S = s;
+else
+    [i j] = find(A);
+    S = sparse(i,j,s,size(A,1),size(A,1));
+end
@@ -0,0 +1,52 @@
+function T = truss_numbers(A,varargin)
+% TRUSS_NUMBERS Compute the truss number of each edge in an undirected graph
+%
+% T = truss_numbers(A) returns a sparse matrix T where T(i,j) is the truss
+% number of edge (i,j).  The k-truss is the largest subgraph where each
+% edge is in at least k-2 triangles.  The truss number of an edge is the
+% largest k such that the edge is in the k-truss.  Edges in no triangle 
+% have truss number 2.  Self-loops have truss number 0, so T has the 
+% structure of A without its diagonal.  The k-truss is a subgraph of the
+% (k-1)-core.
+%
+% t = truss_numbers(A,struct('edge_list',1)) returns the truss numbers
+% as a vector in the same order as the edges in indexed_sparse and 
+% edge_weight_vector.
+%
+% The graph must be undirected.  Self-loops are ignored.
+%
+% ... = truss_numbers(A,...) takes a set of
+% key-value pairs or an options structure.  See set_matlab_bgl_options
+% for the standard options. 
+%   options.edge_list: return the truss numbers as a vector over the 
+%       edges instead of a matrix [{0} | 1]
+%
+% Example:
+%    load('graphs/clique-10.mat');
+%    T = truss_numbers(A)
+%
+% See also TRIANGLE_COUNTS, CORE_NUMBERS
+
+% David Gleich
+% Copyright, Stanford University, 2006-2008
+
+%% History
+%  2026-10-19: Initial version
+%%
+
+[trans check full2sparse] = get_matlab_bgl_options(varargin{:});
+if full2sparse && ~issparse(A), A = sparse(A); end
+
+options = struct('edge_list', 0);
+options = merge_options(options,varargin{:});
+
+if check, check_matlab_bgl(A,struct('sym',1)); end
+
+t = triangles_mex(A,'truss');
+
+if options.edge_list
+    T = t;
+else
+    [i j] = find(A);
+    T = sparse(i,j,t,size(A,1),size(A,1));
+end
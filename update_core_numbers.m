@@ -0,0 +1,57 @@
+function [cn nvisited] = update_core_numbers(A,cn,insertions,deletions,varargin)
+% UPDATE_CORE_NUMBERS Update core numbers after inserting and deleting edges
+%
+% cn = update_core_numbers(A,cn,insertions,deletions) returns the core 
+% numbers of the undirected graph A given the core numbers cn of the 
+% graph before a batch of edge changes.  Each row of the k-by-2 matrix 
+% insertions is an edge [i j] in A that was not in the old graph, and 
+% each row of deletions is an edge [i j] that was in the old graph but is
+% not in A.  List each undirected edge once.  Either matrix may be empty.
+%
+% Each change only visits the vertices connected to the edge through
+% vertices with the same core number, so small batches of changes are 
+% much faster than calling core_numbers again on the new graph.
+% [cn nvisited] = update_core_numbers(...) also returns the total number
+% of vertices visited.
+%
+% ... = update_core_numbers(A,...) takes a set of
+% key-value pairs or an options structure.  See set_matlab_bgl_options
+% for the standard options. 
+%
+% Example:
+%    A = sparse(ones(5)-eye(5));
+%    cn = core_numbers(A);
+%    A(1,2) = 0; A(2,1) = 0;
+%    cn = update_core_numbers(A,cn,[],[1 2])
+%
+% See also CORE_NUMBERS
+
+% David Gleich
+% Copyright, Stanford University, 2007-2008
+
+%% History
+%  2026-10-19: Initial version
+%%
+
+[trans check full2sparse] = get_matlab_bgl_options(varargin{:});
+if full2sparse && ~issparse(A), A = sparse(A); end
+
+if isempty(insertions), insertions = zeros(0,2); end
+if isempty(deletions), deletions = zeros(0,2); end
+
+if check
+    check_matlab_bgl(A,struct('sym',1)); 
+    if size(insertions,2) ~= 2 || size(deletions,2) ~= 2
+        error('matlab_bgl:invalidParameter',...
+            'the insertions and deletions must have two columns');
+    end
+    ii = sub2ind(size(A),insertions(:,1),insertions(:,2));
+    di = sub2ind(size(A),deletions(:,1),deletions(:,2));
+    if any(A(ii) == 0) || any(A(di) ~= 0)
+        error('matlab_bgl:invalidParameter',...
+            'the insertions must be in A and the deletions must not be');
+    end
+end
+
+[cn nvisited] = update_core_numbers_mex(A,full(double(cn(:))),...
+    insertions(:,1)-1,insertions(:,2)-1,deletions(:,1)-1,deletions(:,2)-1);
@@ -0,0 +1,76 @@
+function [m,w]=weighted_matching(A,varargin)
+% WEIGHTED_MATCHING Compute a 1/2-approximate maximum weight matching
+%
+% m=weighted_matching(A) returns a matching between the vertices of an
+% undirected graph with edge weights given by the matrix A.  The output
+% uses the same format as the MATCHING function: m(v) = u if vertex v is
+% matched to vertex u or m(v) = 0 if vertex v is not matched.  The total
+% weight of the matching is at least half the weight of a maximum weight
+% matching.  
+%
+% [m,w]=weighted_matching(A) also returns the total weight of the
+% matching.
+%
+% The algorithm is the Suitor algorithm, which finds the same matching as
+% the greedy algorithm that repeatedly picks the heaviest edge with two
+% unmatched endpoints.  Each vertex proposes to its heaviest neighbor that 
+% does not already have a better suitor, and the proposals run in
+% parallel when libmbgl is compiled with OpenMP.  Ties in the weight are
+% broken by the vertex index.  Edges with non-positive weight and self 
+% loops are never matched.  
+%
+% This method works on undirected graphs (symmetric matrices).
+% The runtime is O(m d) where d is the largest degree in the graph, and it
+% is usually close to O(m).
+%
+% ...=weighted_matching(A,...) takes a set of
+% key-value pairs or an options structure.  See set_matlab_bgl_options
+% for the standard options. 
+%   options.edge_weight: a double array over the edges with an edge
+%       weight for each edge, see EDGE_INDEX and EXAMPLES/REWEIGHTED_GRAPHS
+%       for information on how to use this option correctly
+%       [{'matrix'} | length(nnz(A)) double vector]
+%   options.matrix_output: return the matching as a sparse matrix [{0} | 1]
+%
+% See also MATCHING, MAXIMAL_MATCHING
+%
+% Example:
+%   load graphs/matching_example.mat
+%   m = weighted_matching(A)
+%   [m,w] = weighted_matching(A.*(rand(size(A))+rand(size(A))'))
+
+% David Gleich
+% Copyright, Stanford University, 2007-2008
+
+%% History
+%  2026-10-19: Initial version
+%%
+
+[trans check full2sparse] = get_matlab_bgl_options(varargin{:});
+if full2sparse && ~issparse(A), A = sparse(A); end
+if trans, end % input must be symmetric, so no need to transpose
+
+options = struct('edge_weight', 'matrix', 'matrix_output', 0);
+options = merge_options(options, varargin{:});
+
+edge_weight_opt = 'matrix';
+if ~strcmp(options.edge_weight, 'matrix')
+    edge_weight_opt = options.edge_weight;
+end
+
+if check
+    if strcmp(edge_weight_opt, 'matrix')
+        check_matlab_bgl(A,struct('sym',1,'values',1));
+    else
+        check_matlab_bgl(A,struct('sym',1));
+    end
+end
+
+[m,w] = weighted_matching_mex(A, edge_weight_opt);
+
+if options.matrix_output
+    mask = m>0;
+    i = (1:size(A,1)); i = i(mask);
+    m = m(mask);
+    m = sparse(i,m,true(1),size(A,1),size(A,1));
+end